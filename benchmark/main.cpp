@@ -0,0 +1,279 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<elf.h>)
+#include <elf.h>
+#endif
+
+#include "DBGHAssert.h"
+#include "DBGHCheckedSpan.h"
+
+namespace
+{
+
+class NullBuffer : public std::streambuf
+{
+protected:
+    int_type overflow(int_type ch) override
+    {
+        return ch;
+    }
+
+    std::streamsize xsputn([[maybe_unused]] const char* s, std::streamsize count) override
+    {
+        return count;
+    }
+};
+
+constexpr std::size_t s_uIterations = 100'000;
+
+template <typename TCallable>
+void Measure(const char* name, const TCallable& callable)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < s_uIterations; ++i)
+    {
+        callable(i);
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << std::left << std::setw(32) << name
+              << std::right << std::setw(12) << (elapsed.count() / static_cast<std::int64_t>(s_uIterations)) << " ns/op" << std::endl;
+}
+
+/**
+ * @brief      The loops guarded by the assumed asserts. If ASSERT_ERROR is compiled out with the assumptions enabled,
+ *              the optimizer removes the bounds checks of at() and vectorizes the loops.
+ */
+std::int64_t CheckedSum(const std::vector<int>& values, const std::size_t count)
+{
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        sum += values.at(i);
+    }
+    return sum;
+}
+
+std::int64_t AssumedCheckedSum(const std::vector<int>& values, const std::size_t count)
+{
+    ASSERT_ERROR_ASSUME(count <= values.size(), "The count {} is out of range.", count);
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        sum += values.at(i);
+    }
+    return sum;
+}
+
+void CheckedScale(std::vector<unsigned>& values, const std::size_t count, const unsigned factor)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        values.at(i) *= factor;
+    }
+}
+
+void AssumedCheckedScale(std::vector<unsigned>& values, const std::size_t count, const unsigned factor)
+{
+    ASSERT_ERROR_ASSUME(count <= values.size() && count % 8 == 0, "The count {} is out of range.", count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        values.at(i) *= factor;
+    }
+}
+
+/**
+ * @brief      The loops over the checked span. The loop with operator[] checks every index, for_each_checked checks
+ *              the range once and the loop is vectorized as the loop over std::span.
+ */
+std::int64_t SpanSum(const std::span<const int> values)
+{
+    std::int64_t sum = 0;
+    for (const int value : values)
+    {
+        sum += value;
+    }
+    return sum;
+}
+
+std::int64_t CheckedSpanSum(const dbgh::checked_span<const int> values, const std::size_t count)
+{
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        sum += values[i];
+    }
+    return sum;
+}
+
+std::int64_t ForEachCheckedSum(const dbgh::checked_span<const int> values, const std::size_t count)
+{
+    std::int64_t sum = 0;
+    values.for_each_checked(0, count, [&sum](const int value) { sum += value; });
+    return sum;
+}
+
+void PrintLatency()
+{
+    constexpr const char* arrLevels[] { "WARNING", "DEBUG", "ERROR", "FATAL", "AUDIT" };
+    constexpr const char* arrPhases[] { "format", "executor", "output" };
+
+    std::cout << std::endl << "Failure path latency (ns):" << std::endl;
+    std::cout << std::left << std::setw(10) << "level" << std::setw(10) << "phase" << std::right
+              << std::setw(10) << "count" << std::setw(10) << "p50" << std::setw(10) << "p90"
+              << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(12) << "max" << std::endl;
+    for (std::size_t level = 0; level < std::size(arrLevels); ++level)
+    {
+        for (std::size_t phase = 0; phase < std::size(arrPhases); ++phase)
+        {
+            const auto summary = dbgh::CFailureLatency::GetSummary(
+                    static_cast<dbgh::EAssertLevel>(level), static_cast<dbgh::EFailurePhase>(phase));
+            if (0 == summary.m_uCount)
+            {
+                continue;
+            }
+            std::cout << std::left << std::setw(10) << arrLevels[level] << std::setw(10) << arrPhases[phase]
+                      << std::right << std::setw(10) << summary.m_uCount << std::setw(10) << summary.m_uP50
+                      << std::setw(10) << summary.m_uP90 << std::setw(10) << summary.m_uP99
+                      << std::setw(10) << summary.m_uP999 << std::setw(12) << summary.m_uMax << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief      Gets the total size of the .rodata sections of the ELF file, zero if the file can not be read.
+ */
+std::uint64_t ReadRodataSize([[maybe_unused]] const char* path)
+{
+#if __has_include(<elf.h>)
+    std::ifstream file { path, std::ios::binary };
+    Elf64_Ehdr header { };
+    if (! file.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || 0 != std::memcmp(header.e_ident, ELFMAG, SELFMAG) || ELFCLASS64 != header.e_ident[EI_CLASS])
+    {
+        return 0;
+    }
+    std::vector<Elf64_Shdr> sections(header.e_shnum);
+    file.seekg(static_cast<std::streamoff>(header.e_shoff));
+    file.read(reinterpret_cast<char*>(sections.data()), static_cast<std::streamsize>(sections.size() * sizeof(Elf64_Shdr)));
+    if (! file || header.e_shstrndx >= sections.size())
+    {
+        return 0;
+    }
+    std::string names(sections[header.e_shstrndx].sh_size, '\0');
+    file.seekg(static_cast<std::streamoff>(sections[header.e_shstrndx].sh_offset));
+    if (! file.read(names.data(), static_cast<std::streamsize>(names.size())))
+    {
+        return 0;
+    }
+    std::uint64_t size = 0;
+    for (const auto& section : sections)
+    {
+        if (section.sh_name < names.size() && std::string_view { names.c_str() + section.sh_name }.starts_with(".rodata"))
+        {
+            size += section.sh_size;
+        }
+    }
+    return size;
+#else
+    return 0;
+#endif
+}
+
+void PrintSiteStrings()
+{
+    const auto plainSize = ReadRodataSize(DBGH_SITE_STRINGS_PLAIN);
+    const auto compressedSize = ReadRodataSize(DBGH_SITE_STRINGS_COMPRESSED);
+    if (0 == plainSize || 0 == compressedSize)
+    {
+        return;
+    }
+    std::cout << std::endl << "Site strings, .rodata of site_strings (bytes):" << std::endl;
+    std::cout << std::left << std::setw(32) << "plain expressions" << std::right << std::setw(10) << plainSize << std::endl;
+    std::cout << std::left << std::setw(32) << "compressed expressions" << std::right << std::setw(10) << compressedSize
+              << std::endl;
+    std::cout << std::left << std::setw(32) << "saved" << std::right << std::setw(10)
+              << static_cast<std::int64_t>(plainSize) - static_cast<std::int64_t>(compressedSize) << std::endl;
+}
+}
+
+int main()
+{
+    NullBuffer nullBuffer;
+    auto* cerrBuffer = std::cerr.rdbuf(&nullBuffer);
+
+    volatile std::size_t sink = 0;
+    Measure("ASSERT_WARNING passed", [&sink](const std::size_t i)
+    {
+        ASSERT_WARNING(i < s_uIterations, "The index {} is out of range.", i);
+        sink = i;
+    });
+    Measure("ASSERT_WARNING failed", [](const std::size_t i)
+    {
+        ASSERT_WARNING(i >= s_uIterations, "The index {} is in range.", i);
+    });
+#ifdef DBGH_ASSERTS_EXCEPTIONS
+    Measure("ASSERT_ERROR failed", [](const std::size_t i)
+    {
+        try
+        {
+            ASSERT_ERROR(i >= s_uIterations, "The index {} is in range.", i);
+        }
+        catch ([[maybe_unused]] const dbgh::CAssertException& e)
+        {
+        }
+    });
+#endif
+    Measure("DBGH_VERIFY failed", [&sink](const std::size_t i)
+    {
+        sink = DBGH_VERIFY(i >= s_uIterations, "The index {} is in range.", i).has_value() ? 1U : 0U;
+    });
+
+    std::vector<int> values(1024);
+    std::iota(std::begin(values), std::end(values), 0);
+    volatile std::size_t count = values.size();
+    volatile std::int64_t sumSink = 0;
+    std::vector<unsigned> scaled(values.size(), 1U);
+    Measure("at() sum", [&values, &count, &sumSink](const std::size_t)
+    {
+        sumSink = CheckedSum(values, count);
+    });
+    Measure("at() sum, ASSERT_ERROR_ASSUME", [&values, &count, &sumSink](const std::size_t)
+    {
+        sumSink = AssumedCheckedSum(values, count);
+    });
+    Measure("at() scale", [&scaled, &count](const std::size_t i)
+    {
+        CheckedScale(scaled, count, static_cast<unsigned>(i & 1U));
+    });
+    Measure("at() scale, ASSERT_ERROR_ASSUME", [&scaled, &count](const std::size_t i)
+    {
+        AssumedCheckedScale(scaled, count, static_cast<unsigned>(i & 1U));
+    });
+    Measure("std::span sum", [&values, &count, &sumSink](const std::size_t)
+    {
+        sumSink = SpanSum(std::span<const int> { values }.first(count));
+    });
+    Measure("checked_span[] sum", [&values, &count, &sumSink](const std::size_t)
+    {
+        sumSink = CheckedSpanSum(values, count);
+    });
+    Measure("for_each_checked sum", [&values, &count, &sumSink](const std::size_t)
+    {
+        sumSink = ForEachCheckedSum(values, count);
+    });
+
+    std::cerr.rdbuf(cerrBuffer);
+    PrintLatency();
+    PrintSiteStrings();
+    return 0;
+}
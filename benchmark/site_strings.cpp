@@ -0,0 +1,71 @@
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "DBGHAssert.h"
+
+// The assertion sites whose read-only data is measured by the benchmark, the file is built twice, with and without
+// DBGH_ASSERTS_COMPRESS_EXPRESSIONS, the difference of the .rodata sizes is the size of the expression texts.
+
+namespace
+{
+
+struct SPacket
+{
+    std::size_t m_uSize;
+    std::uint32_t m_uChecksum;
+    const char* m_pData;
+};
+
+struct SNode
+{
+    SNode* m_pParent;
+    SNode* m_pLeft;
+    SNode* m_pRight;
+    int m_iKey;
+};
+
+void CheckPacket(const SPacket& packet, const std::size_t capacity)
+{
+    ASSERT_WARNING(nullptr != packet.m_pData, "The packet has no data.");
+    ASSERT_WARNING(packet.m_uSize <= capacity, "The packet size {} exceeds {}.", packet.m_uSize, capacity);
+    ASSERT_WARNING(0 != packet.m_uChecksum || 0 == packet.m_uSize, "The checksum is missing.");
+    ASSERT_ERROR(static_cast<std::size_t>(packet.m_uChecksum % 256) < capacity, "The bucket is out of range.");
+    ASSERT_ERROR(nullptr == packet.m_pData || packet.m_pData[packet.m_uSize] == '\0', "The data is not terminated.");
+}
+
+void CheckNode(const SNode& node)
+{
+    ASSERT_WARNING(nullptr == node.m_pLeft || node.m_pLeft->m_iKey < node.m_iKey, "The left key is too large.");
+    ASSERT_WARNING(nullptr == node.m_pRight || node.m_pRight->m_iKey > node.m_iKey, "The right key is too small.");
+    ASSERT_WARNING(nullptr == node.m_pLeft || &node == node.m_pLeft->m_pParent, "The left parent is wrong.");
+    ASSERT_WARNING(nullptr == node.m_pRight || &node == node.m_pRight->m_pParent, "The right parent is wrong.");
+    ASSERT_ERROR(nullptr == node.m_pParent || node.m_pParent->m_pLeft == &node || node.m_pParent->m_pRight == &node
+                 , "The node is not a child of its parent.");
+}
+
+void CheckValues(const std::vector<int>& values, const std::size_t index, const int count)
+{
+    ASSERT_WARNING(index < values.size() || std::empty(values), "The index {} is out of range.", index);
+    ASSERT_WARNING(static_cast<std::size_t>(count) <= values.capacity(), "The count {} is too large.", count);
+    ASSERT_WARNING(count >= 0 && count <= static_cast<int>(values.size()), "The count {} is invalid.", count);
+    ASSERT_ERROR(values.empty() || values.front() <= values.back(), "The values are not sorted.");
+    ASSERT_ERROR(values.size() == values.capacity() || values.size() < values.capacity(), "The vector is corrupted.");
+}
+
+} // unnamed namespace
+
+int main(const int argc, const char* argv[])
+{
+    const std::string_view name { argv[0] };
+    const SPacket packet { name.size(), static_cast<std::uint32_t>(argc), name.data() };
+    CheckPacket(packet, name.size() + 256);
+
+    SNode root { nullptr, nullptr, nullptr, argc };
+    CheckNode(root);
+
+    const std::vector<int> values(name.size(), argc);
+    CheckValues(values, 0, argc);
+    return 0;
+}
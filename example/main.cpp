@@ -41,6 +41,7 @@ int main()
 
     int* invalidPtr = nullptr;
     WarningExample(invalidPtr);
+#ifdef DBGH_ASSERTS_EXCEPTIONS
     try
     {
         ErrorExample(invalidPtr);
@@ -54,6 +55,7 @@ int main()
             << "LineNumber: "  << e.LineNumber() << std::endl
             << std::endl;
     }
+#endif
 
 
     DebugExample(invalidPtr);
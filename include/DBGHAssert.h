@@ -11,47 +11,199 @@
 #include <format>
 
 #include "impl/CAssertException.h"
+#include "impl/CExpressionText.h"
 #include "impl/CAssertConfig.h"
 #include "impl/CAssertHandler.h"
+#include "impl/CAssertSite.h"
+#include "impl/CConstantCheck.h"
+#include "impl/CAssertGovernor.h"
+#include "impl/CAssertLimiter.h"
+#include "impl/CCircuitBreaker.h"
+#include "impl/CScopedSuppress.h"
+#include "impl/CRangeCheck.h"
+#include "impl/CParallelCheck.h"
+#include "impl/CAddressMap.h"
+#include "impl/CDeferredVerifier.h"
+#include "impl/CAssertContext.h"
+#include "impl/CFailureLatency.h"
+#include "impl/CProbes.h"
+#include "impl/CAssertProfiler.h"
+#include "impl/CVerifier.h"
+#include "impl/DBGHDebugBreak.h"
 
 
-#ifdef _MSC_VER
+/**
+ * @internal
+ * @brief      The helper macros for making the unique names of the local variables.
+ */
+#define IMPL_DBGH_CONCAT_IMPL(_a_, _b_) _a_##_b_
+#define IMPL_DBGH_CONCAT(_a_, _b_)      IMPL_DBGH_CONCAT_IMPL(_a_, _b_)
+
 
 /**
- * @brief       START_DEBUGGING intrinsic at any point in your code. __debugbreak has the same effect as setting a breakpoint
- *               at that location using a debugger.
- *
- * @note        Working on Win32 platforms.
+ * @internal
+ * @brief      Tells the optimizer that the expression is always true. The expression must be free of side effects,
+ *              it may be evaluated or not.
  */
-#define START_DEBUGGING  __debugbreak()
+#if __cplusplus > 202002L && __has_cpp_attribute(assume)
+#define IMPL_DBGH_ASSUME(_expression_)      [[assume(_expression_)]]
+#elif defined(__clang__)
+#define IMPL_DBGH_ASSUME(_expression_)      __builtin_assume(_expression_)
+#elif defined(_MSC_VER)
+#define IMPL_DBGH_ASSUME(_expression_)      __assume(_expression_)
 #else
+#define IMPL_DBGH_ASSUME(_expression_)      if (! (_expression_)) { __builtin_unreachable(); } (void) 0
+#endif
+
 
 /**
- * @brief       START_DEBUGGING intrinsic at any point in your code. __asm__ volatile("int $0x03") has the same effect as
- *               setting a breakpoint at that location using a debugger.
- *
- * @note        Working on GNU platforms.
+ * @internal
+ * @brief      The compiled out assert, the expression is not evaluated, but it is still checked by the compiler.
+ */
+#define IMPL_DBGH_COMPILED_OUT(_expression_)    static_cast<void>(sizeof(bool(_expression_)))
+
+
+/**
+ * @internal
+ * @brief      The compiled out assert which is opted in for the assumption. With DBGH_ASSERTS_ASSUME the expression
+ *              becomes the optimizer assumption, otherwise it is dropped as the other compiled out asserts.
  */
-#define START_DEBUGGING __asm__ volatile("int $0x03")
+#ifdef DBGH_ASSERTS_ASSUME
+#define IMPL_DBGH_COMPILED_OUT_ASSUME(_expression_)    IMPL_DBGH_ASSUME(_expression_)
+#else
+#define IMPL_DBGH_COMPILED_OUT_ASSUME(_expression_)    IMPL_DBGH_COMPILED_OUT(_expression_)
 #endif
 
 
+/**
+ * @internal
+ * @brief      The circuit breaker state of the assertion site, see \ref dbgh::impl::CCircuitBreaker.
+ */
+#define IMPL_DBGH_BREAKER_SITE()                                                                                                        \
+    []() -> dbgh::impl::SBreakerSite& { static constinit dbgh::impl::SBreakerSite dbghBreaker_ { }; return dbghBreaker_; }()
+
+
+/**
+ * @brief      The helper macro using for place code for asserts in one line.
+ *
+ * @param      _channel_     The channel, \ref dbgh::SChannel.
+ * @param      _level_       The assert level.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      _text_        The expression text which will appear in the assertion information.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define IMPL_DBGH_ASSERT_TEXT(_channel_, _level_, _expression_, _text_, ...)                                                            \
+    if ( dbgh::impl::CConstantCheck::IsConstantEvaluated() )                                                                            \
+    {                                                                                                                                   \
+        IMPL_DBGH_CONSTANT_CHECK(_expression_, _text_, __VA_ARGS__);                                                                    \
+    }                                                                                                                                   \
+    else if ( dbgh::CAssertConfig::Get().IsActiveAssert(_channel_, _level_) && IMPL_DBGH_PROBE_EVAL(_level_)                            \
+              && ! IMPL_DBGH_EVALUATE(_level_, _expression_, _text_)                                                                    \
+              && dbgh::impl::CCircuitBreaker::ShouldReport(IMPL_DBGH_BREAKER_SITE(), _level_, IMPL_DBGH_TEXT(_text_)                    \
+                                                           , IMPL_DBGH_FILE, __LINE__, __func__) )                                      \
+    {                                                                                                                                   \
+        dbgh::impl::CAssertHandler::HandleAssert<_level_>(std::format(__VA_ARGS__)                                                      \
+                                                       , IMPL_DBGH_TEXT(_text_) , IMPL_DBGH_FILE                                        \
+                                                       , __LINE__, __func__);                                                           \
+    }                                                                                                                                   \
+    (void) 0
+
+
+/**
+ * @brief      The helper macro using for place code for asserts in one line.
+ *
+ * @param      _channel_     The channel, \ref dbgh::SChannel.
+ * @param      _level_       The assert level.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define IMPL_DBGH_ASSERT(_channel_, _level_, _expression_, ...)                                                                         \
+    IMPL_DBGH_ASSERT_TEXT(_channel_, _level_, _expression_, #_expression_, __VA_ARGS__)
+
+
 /**
  * @brief      The helper macro using for place code for asserts in one line.
+ *              Specialization for ASSERT_DEBUG.
  *
+ * @param      _channel_     The channel, \ref dbgh::SChannel.
  * @param      _level_       The assert level.
  * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      _text_        The expression text which will appear in the assertion information.
  * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
  */
-#define IMPL_DBGH_ASSERT(_level_, _expression_, ...)                                                                                    \
-    if ( dbgh::CAssertConfig::Get().IsActiveAssert(_level_) && ! bool(_expression_) )                                                   \
+#define IMPL_DBGH_ASSERT_DEBUG_TEXT(_channel_, _level_, _expression_, _text_, ...)                                                      \
+    if ( dbgh::impl::CConstantCheck::IsConstantEvaluated() )                                                                            \
+    {                                                                                                                                   \
+        IMPL_DBGH_CONSTANT_CHECK(_expression_, _text_, __VA_ARGS__);                                                                    \
+    }                                                                                                                                   \
+    else                                                                                                                                \
     {                                                                                                                                   \
-        try {                                                                                                                           \
+        bool& dbghIgnore_ = []() -> bool& { static bool dbghIgnoreForever_ { false }; return dbghIgnoreForever_; }();                   \
+        if ( (! dbghIgnore_) && (dbgh::CAssertConfig::Get().IsActiveAssert(_channel_, _level_))                                         \
+             && IMPL_DBGH_PROBE_EVAL(_level_) && (! IMPL_DBGH_EVALUATE(_level_, _expression_, _text_))                                  \
+             && dbgh::impl::CCircuitBreaker::ShouldReport(IMPL_DBGH_BREAKER_SITE(), _level_, IMPL_DBGH_TEXT(_text_)                     \
+                                                          , IMPL_DBGH_FILE, __LINE__, __func__) )                                       \
+        {                                                                                                                               \
+            if ( dbgh::impl::CAssertHandler::HandleAssert<_level_>(std::format(__VA_ARGS__)                                             \
+                                                                , IMPL_DBGH_TEXT(_text_) , IMPL_DBGH_FILE                               \
+                                                                , __LINE__, __func__, dbghIgnore_) )                                    \
+            {                                                                                                                           \
+                START_DEBUGGING;                                                                                                        \
+            }                                                                                                                           \
+        }                                                                                                                               \
+    }                                                                                                                                   \
+    (void) 0
+
+
+/**
+ * @brief      The helper macro using for place code for asserts in one line.
+ *              Specialization for ASSERT_DEBUG.
+ *
+ * @param      _channel_     The channel, \ref dbgh::SChannel.
+ * @param      _level_       The assert level.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define IMPL_DBGH_ASSERT_DEBUG(_channel_, _level_, _expression_, ...)                                                                   \
+    IMPL_DBGH_ASSERT_DEBUG_TEXT(_channel_, _level_, _expression_, #_expression_, __VA_ARGS__)
+
+
+/**
+ * @brief      The helper macro using for place code for asserts in one line.
+ *              Specialization for sampled asserts, the expression is evaluated only on 1-in-N executions,
+ *              its cost is accounted by the CPU budget governor.
+ *
+ * @param      _channel_     The channel, \ref dbgh::SChannel.
+ * @param      _level_       The assert level.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define IMPL_DBGH_ASSERT_SAMPLED(_channel_, _level_, _expression_, ...)                                                                 \
+    if ( dbgh::impl::CConstantCheck::IsConstantEvaluated() )                                                                            \
+    {                                                                                                                                   \
+        IMPL_DBGH_CONSTANT_CHECK(_expression_, #_expression_, __VA_ARGS__);                                                             \
+    }                                                                                                                                   \
+    else                                                                                                                                \
+    {                                                                                                                                   \
+        constexpr const char* dbghFunction_ = __func__;                                                                                 \
+        auto& dbghSite_ = []() -> dbgh::impl::SAssertSite& {                                                                            \
+            static constinit dbgh::impl::SAssertSite dbghSampled_ {                                                                     \
+                    _level_, IMPL_DBGH_TEXT(#_expression_), IMPL_DBGH_FILE, __LINE__, dbghFunction_ };                                  \
+            return dbghSampled_;                                                                                                        \
+        }();                                                                                                                            \
+        auto& dbghCountdown_ = []() -> std::uint32_t& { static thread_local std::uint32_t dbghCounter_ { 0 }; return dbghCounter_; }(); \
+        if ( (dbgh::CAssertConfig::Get().IsActiveAssert(_channel_, _level_))                                                            \
+             && (dbgh::impl::CAssertSampler::ShouldEvaluate(dbghSite_, dbghCountdown_))                                                 \
+             && IMPL_DBGH_PROBE_EVAL(_level_)                                                                                           \
+             && (! dbgh::impl::CAssertGovernor::Evaluate(dbghSite_, dbghCountdown_, [&]() -> bool {                                     \
+                       return IMPL_DBGH_EVALUATE(_level_, _expression_, #_expression_);                                                 \
+                   }))                                                                                                                  \
+             && dbgh::impl::CCircuitBreaker::ShouldReport(dbghSite_.m_breaker, _level_, dbghSite_.m_strExpression                       \
+                                                          , dbghSite_.m_strFile, __LINE__, __func__) )                                  \
+        {                                                                                                                               \
             dbgh::impl::CAssertHandler::HandleAssert<_level_>(std::format(__VA_ARGS__)                                                  \
-                                                           , #_expression_ , __FILE__                                                   \
+                                                           , IMPL_DBGH_TEXT(#_expression_) , IMPL_DBGH_FILE                             \
                                                            , __LINE__, __func__);                                                       \
-        } catch (const dbgh::CAssertException& e) {                                                                                     \
-            throw e;                                                                                                                    \
         }                                                                                                                               \
     }                                                                                                                                   \
     (void) 0
@@ -59,27 +211,71 @@
 
 /**
  * @brief      The helper macro using for place code for asserts in one line.
- *              Specialization for ASSERT_DEBUG.
+ *              Specialization for rate limited asserts, the failure is counted by the per-site counter and
+ *              reported only if the limiter allows it. The circuit breaker counts only the failures allowed by
+ *              the limiter.
  *
+ * @param      _channel_     The channel, \ref dbgh::SChannel.
  * @param      _level_       The assert level.
+ * @param      _limiter_     The \ref dbgh::impl::CAssertLimiter method, IsFirstN or IsEveryN.
+ * @param      _count_       The count or the period of the reported failures.
  * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
  * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
  */
-#define IMPL_DBGH_ASSERT_DEBUG(_level_, _expression_, ...)                                                                              \
+#define IMPL_DBGH_ASSERT_LIMITED(_channel_, _level_, _limiter_, _count_, _expression_, ...)                                             \
+    if ( dbgh::impl::CConstantCheck::IsConstantEvaluated() )                                                                            \
     {                                                                                                                                   \
-        static bool __ignore { false };                                                                                                 \
-        if ( (! __ignore) && (dbgh::CAssertConfig::Get().IsActiveAssert(_level_)) && (! bool(_expression_)) )                           \
+        IMPL_DBGH_CONSTANT_CHECK(_expression_, #_expression_, __VA_ARGS__);                                                             \
+    }                                                                                                                                   \
+    else if ( dbgh::CAssertConfig::Get().IsActiveAssert(_channel_, _level_) && IMPL_DBGH_PROBE_EVAL(_level_)                            \
+              && ! IMPL_DBGH_EVALUATE(_level_, _expression_, #_expression_)                                                             \
+              && dbgh::impl::CAssertLimiter::_limiter_([]() -> std::atomic<std::uint64_t>& {                                            \
+                     static constinit std::atomic<std::uint64_t> dbghFailures_ { 0 };                                                   \
+                     return dbghFailures_;                                                                                              \
+                 }(), static_cast<std::uint64_t>(_count_))                                                                              \
+              && dbgh::impl::CCircuitBreaker::ShouldReport(IMPL_DBGH_BREAKER_SITE(), _level_, IMPL_DBGH_TEXT(#_expression_)             \
+                                                           , IMPL_DBGH_FILE, __LINE__, __func__) )                                      \
+    {                                                                                                                                   \
+        dbgh::impl::CAssertHandler::HandleAssert<_level_>(std::format(__VA_ARGS__)                                                      \
+                                                       , IMPL_DBGH_TEXT(#_expression_) , IMPL_DBGH_FILE                                 \
+                                                       , __LINE__, __func__);                                                           \
+    }                                                                                                                                   \
+    (void) 0
+
+
+/**
+ * @brief      The helper macro using for place code for asserts in one line.
+ *              Specialization for periodic asserts, the expression is evaluated at most once per interval.
+ *
+ * @param      _channel_     The channel, \ref dbgh::SChannel.
+ * @param      _level_       The assert level.
+ * @param      _interval_    The std::chrono duration, the minimal interval between the evaluations.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define IMPL_DBGH_ASSERT_PERIODIC(_channel_, _level_, _interval_, _expression_, ...)                                                    \
+    if ( dbgh::impl::CConstantCheck::IsConstantEvaluated() )                                                                            \
+    {                                                                                                                                   \
+        IMPL_DBGH_CONSTANT_CHECK(_expression_, #_expression_, __VA_ARGS__);                                                             \
+    }                                                                                                                                   \
+    else                                                                                                                                \
+    {                                                                                                                                   \
+        auto& dbghPeriodic_ = []() -> dbgh::impl::SPeriodicSite& {                                                                      \
+            static constinit dbgh::impl::SPeriodicSite dbghSite_ { };                                                                   \
+            return dbghSite_;                                                                                                           \
+        }();                                                                                                                            \
+        if ( (dbgh::CAssertConfig::Get().IsActiveAssert(_channel_, _level_))                                                            \
+             && (dbgh::impl::CAssertLimiter::IsDue(dbghPeriodic_, _interval_))                                                          \
+             && IMPL_DBGH_PROBE_EVAL(_level_) && (! IMPL_DBGH_EVALUATE(_level_, _expression_, #_expression_))                           \
+             && dbgh::impl::CCircuitBreaker::ShouldReport(IMPL_DBGH_BREAKER_SITE(), _level_, IMPL_DBGH_TEXT(#_expression_)              \
+                                                          , IMPL_DBGH_FILE, __LINE__, __func__) )                                       \
         {                                                                                                                               \
-            try {                                                                                                                       \
-                dbgh::impl::CAssertHandler::HandleAssert<_level_>(std::format(__VA_ARGS__)                                              \
-                                                               , #_expression_ , __FILE__                                               \
-                                                               , __LINE__, __func__, __ignore);                                         \
-            } catch (const dbgh::impl::CAssertHandler::SStartDebuggingException) {                                                      \
-                 START_DEBUGGING;                                                                                                       \
-            } catch (const dbgh::CAssertException& e) {                                                                                 \
-                throw e;                                                                                                                \
+            if ( dbgh::impl::CAssertHandler::HandleAssert(_level_, std::format(__VA_ARGS__)                                             \
+                                                        , IMPL_DBGH_TEXT(#_expression_) , IMPL_DBGH_FILE, __LINE__, __func__            \
+                                                        , dbghPeriodic_.m_bIgnoreForever) )                                             \
+            {                                                                                                                           \
+                START_DEBUGGING;                                                                                                        \
             }                                                                                                                           \
-                                                                                                                                        \
         }                                                                                                                               \
     }                                                                                                                                   \
     (void) 0
@@ -137,7 +333,31 @@
  * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
  * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
  */
-#define ASSERT_DEBUG(_expression_, ...)    IMPL_DBGH_ASSERT_DEBUG(dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#if defined(DBGH_ASSERTS_NO_DEBUG) && ! defined(DEBUG)
+#define ASSERT_DEBUG(_expression_, ...)    IMPL_DBGH_COMPILED_OUT(_expression_)
+#else
+#define ASSERT_DEBUG(_expression_, ...)                                                                                                 \
+    IMPL_DBGH_ASSERT_DEBUG(dbgh::SChannel { }, dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#endif
+
+/**
+ * @brief      The same as \ref ASSERT_DEBUG, but if ASSERT_DEBUG is compiled out (DBGH_ASSERTS_NO_DEBUG) and the
+ *              assumptions are enabled (DBGH_ASSERTS_ASSUME), the expression becomes the optimizer assumption.
+ *              The optimizer can remove the bounds checks and vectorize the loops guarded by such assertions.
+ *
+ * @note       The expression must be free of side effects. If the assumed expression is false, the behavior is undefined.
+ *
+ * @example    The use example.
+ *              ASSERT_DEBUG_ASSUME(count <= vec.size(), "The count {} is out of range.", count);
+ *
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#if defined(DBGH_ASSERTS_NO_DEBUG) && ! defined(DEBUG)
+#define ASSERT_DEBUG_ASSUME(_expression_, ...)    IMPL_DBGH_COMPILED_OUT_ASSUME(_expression_)
+#else
+#define ASSERT_DEBUG_ASSUME(_expression_, ...)    ASSERT_DEBUG(_expression_, __VA_ARGS__)
+#endif
 
 #ifndef DEBUG
 
@@ -184,7 +404,48 @@
  * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
  * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
  */
-#define ASSERT_WARNING(_expression_, ...)  IMPL_DBGH_ASSERT(dbgh::EAssertLevel::Warning, _expression_, __VA_ARGS__)
+#define ASSERT_WARNING(_expression_, ...)  IMPL_DBGH_ASSERT(dbgh::SChannel { }, dbgh::EAssertLevel::Warning, _expression_, __VA_ARGS__)
+
+/**
+ * @brief      The same as \ref ASSERT_WARNING, but only the first failure of the site is reported.
+ *              The pass path is the same as ASSERT_WARNING, the next failures cost one atomic increment.
+ *
+ * @example    The use example.
+ *              ASSERT_ONCE(std::isfinite(weight), "The weight {} is not finite, it is skipped.", weight);
+ *
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define ASSERT_ONCE(_expression_, ...)                                                                                                  \
+    IMPL_DBGH_ASSERT_LIMITED(dbgh::SChannel { }, dbgh::EAssertLevel::Warning, IsFirstN, 1, _expression_, __VA_ARGS__)
+
+/**
+ * @brief      The same as \ref ASSERT_WARNING, but only the first _count_ failures of the site are reported.
+ *              The counter is shared by all threads which execute the site.
+ *
+ * @example    The use example.
+ *              ASSERT_FIRST_N(10, packet.m_uSize <= s_uMtu, "The packet size {} exceeds MTU.", packet.m_uSize);
+ *
+ * @param      _count_       The count of the reported failures.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define ASSERT_FIRST_N(_count_, _expression_, ...)                                                                                      \
+    IMPL_DBGH_ASSERT_LIMITED(dbgh::SChannel { }, dbgh::EAssertLevel::Warning, IsFirstN, _count_, _expression_, __VA_ARGS__)
+
+/**
+ * @brief      The same as \ref ASSERT_WARNING, but only the first failure of the site and then every _period_-th
+ *              failure are reported. The counter is shared by all threads which execute the site.
+ *
+ * @example    The use example.
+ *              ASSERT_EVERY_N(1000, queue.size() < s_uHighWater, "The queue size is {}.", queue.size());
+ *
+ * @param      _period_      The period of the reported failures.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define ASSERT_EVERY_N(_period_, _expression_, ...)                                                                                     \
+    IMPL_DBGH_ASSERT_LIMITED(dbgh::SChannel { }, dbgh::EAssertLevel::Warning, IsEveryN, _period_, _expression_, __VA_ARGS__)
 
 /**
  * @brief      If the argument expression of this macro with functional form compares equal to 0 (i.e., the expression is false),
@@ -231,7 +492,29 @@
  * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
  * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
  */
-#define ASSERT_ERROR(_expression_, ...)    IMPL_DBGH_ASSERT(dbgh::EAssertLevel::Error, _expression_, __VA_ARGS__)
+#ifdef DBGH_ASSERTS_NO_ERROR
+#define ASSERT_ERROR(_expression_, ...)    IMPL_DBGH_COMPILED_OUT(_expression_)
+#else
+#define ASSERT_ERROR(_expression_, ...)    IMPL_DBGH_ASSERT(dbgh::SChannel { }, dbgh::EAssertLevel::Error, _expression_, __VA_ARGS__)
+#endif
+
+/**
+ * @brief      The same as \ref ASSERT_ERROR, but if ASSERT_ERROR is compiled out (DBGH_ASSERTS_NO_ERROR) and the
+ *              assumptions are enabled (DBGH_ASSERTS_ASSUME), the expression becomes the optimizer assumption.
+ *
+ * @note       The expression must be free of side effects. If the assumed expression is false, the behavior is undefined.
+ *
+ * @example    The use example.
+ *              ASSERT_ERROR_ASSUME(count % 8 == 0, "The count {} is not a multiple of 8.", count);
+ *
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#ifdef DBGH_ASSERTS_NO_ERROR
+#define ASSERT_ERROR_ASSUME(_expression_, ...)    IMPL_DBGH_COMPILED_OUT_ASSUME(_expression_)
+#else
+#define ASSERT_ERROR_ASSUME(_expression_, ...)    ASSERT_ERROR(_expression_, __VA_ARGS__)
+#endif
 
 /**
  * @brief      If the argument expression of this macro with functional form compares equal to 0 (i.e., the expression is false),
@@ -279,7 +562,34 @@
  * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
  * @param      .             The string and args for formating will appear as a runtime error if the _expression_ is false.
  */
-#define ASSERT_FATAL(_expression_, ...)    IMPL_DBGH_ASSERT(dbgh::EAssertLevel::Fatal, _expression_, __VA_ARGS__)
+#define ASSERT_FATAL(_expression_, ...)    IMPL_DBGH_ASSERT(dbgh::SChannel { }, dbgh::EAssertLevel::Fatal, _expression_, __VA_ARGS__)
+
+/**
+ * @brief      The sampled assert for expensive invariants, for example a tree balance or a free-list consistency.
+ *              The expression is evaluated only on 1-in-N executions of the site on each thread, so the check can
+ *              run continuously in production at a bounded CPU cost. If the evaluated expression is false, this
+ *              causes an assertion failure that calls HandleWarning in \ref dbgh::CHandlerExecutor.
+ *
+ * @note       N is configured at runtime for the level or for the specific site.
+ * @example    dbgh::CAssertConfig::Get().SetSamplingRate(dbgh::EAssertLevel::Audit, 1000);
+ *             dbgh::CAssertConfig::Get().SetSamplingRate("CTree.cpp", 142, 10);
+ *
+ * @example    The use example.
+ *              ASSERT_AUDIT(tree.IsBalanced(), "The tree with {} nodes is not balanced.", tree.size());
+ *
+ * @details    Prints information about assertion, the message contains:
+ *              > Assertion type - AUDIT
+ *              > Uncaught exc - The number of uncaught exceptions.
+ *              > Filename - where the assertion is failed.
+ *              > Function name - where the assertion is failed.
+ *              > Expression - condition for the assertion that is failed.
+ *              > Message - _message_ string literal passed to the assertion.
+ *
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define ASSERT_AUDIT(_expression_, ...)                                                                                                 \
+    IMPL_DBGH_ASSERT_SAMPLED(dbgh::SChannel { }, dbgh::EAssertLevel::Audit, _expression_, __VA_ARGS__)
 
 #else
 
@@ -288,8 +598,509 @@
  *
  * @details    In debug mode, all asserts replace to \ref ASSERT_DEBUG
  */
-#define ASSERT_WARNING(_expression_, ...)  IMPL_DBGH_ASSERT_DEBUG(dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
-#define ASSERT_ERROR(_expression_, ...)    IMPL_DBGH_ASSERT_DEBUG(dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
-#define ASSERT_FATAL(_expression_, ...)    IMPL_DBGH_ASSERT_DEBUG(dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#define ASSERT_WARNING(_expression_, ...)                                                                                               \
+    IMPL_DBGH_ASSERT_DEBUG(dbgh::SChannel { }, dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#define ASSERT_ERROR(_expression_, ...)                                                                                                 \
+    IMPL_DBGH_ASSERT_DEBUG(dbgh::SChannel { }, dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#define ASSERT_ERROR_ASSUME(_expression_, ...)    ASSERT_DEBUG(_expression_, __VA_ARGS__)
+#define ASSERT_FATAL(_expression_, ...)                                                                                                 \
+    IMPL_DBGH_ASSERT_DEBUG(dbgh::SChannel { }, dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#define ASSERT_AUDIT(_expression_, ...)                                                                                                 \
+    IMPL_DBGH_ASSERT_DEBUG(dbgh::SChannel { }, dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#define ASSERT_ONCE(_expression_, ...)     ASSERT_WARNING(_expression_, __VA_ARGS__)
+#define ASSERT_FIRST_N(_count_, _expression_, ...)     ASSERT_WARNING(_expression_, __VA_ARGS__)
+#define ASSERT_EVERY_N(_period_, _expression_, ...)    ASSERT_WARNING(_expression_, __VA_ARGS__)
+
+#endif
+
+
+/**
+ * @brief      Declares the assertion channel dbgh::channels::_name_, a subsystem with its own set of enabled levels.
+ *              The macro is placed at the global namespace scope, for example in a header of the subsystem.
+ *
+ * @note       The index must be unique in the program, between 1 and dbgh::SChannel::s_uMaxCount - 1.
+ *              The program is aborted at the start if two channels have the same index.
+ *              The index zero is the default channel of the asserts without the _CH suffix.
+ *
+ * @example    DBGH_CHANNEL(storage, 1);
+ *             ASSERT_ERROR_CH(storage, offset < size, "The offset {} is out of the file.", offset);
+ *             dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage, dbgh::LevelMask(dbgh::EAssertLevel::Fatal));
+ *
+ * @param      _name_   The name of the channel.
+ * @param      _index_  The index of the channel.
+ */
+#define DBGH_CHANNEL(_name_, _index_)                                                                                                   \
+    namespace dbgh::channels                                                                                                            \
+    {                                                                                                                                   \
+        static_assert(0 < (_index_) && (_index_) < dbgh::SChannel::s_uMaxCount, "The channel index is out of range.");                  \
+        inline constexpr dbgh::SChannel _name_ { (_index_), #_name_ };                                                                  \
+        inline const bool dbghRegistered_##_name_ = dbgh::CAssertConfig::Get().DeclareChannel(_name_);                                  \
+    }                                                                                                                                   \
+    static_assert(true, "")
+
+
+/**
+ * @brief      The asserts of the channel declared by \ref DBGH_CHANNEL. The same as the asserts without the _CH suffix,
+ *              but the level is checked against the enabled levels of the channel, by one indexed load.
+ *              ASSERT_ONCE_CH, ASSERT_FIRST_N_CH and ASSERT_EVERY_N_CH take the channel before the other arguments.
+ *
+ * @example    The use example.
+ *              ASSERT_WARNING_CH(network, latency < timeout, "The latency {} is too high.", latency);
+ *
+ * @param      _channel_     The name of the channel.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#ifndef DEBUG
+
+#ifdef DBGH_ASSERTS_NO_DEBUG
+#define ASSERT_DEBUG_CH(_channel_, _expression_, ...)      IMPL_DBGH_COMPILED_OUT(_expression_)
+#else
+#define ASSERT_DEBUG_CH(_channel_, _expression_, ...)                                                                                   \
+    IMPL_DBGH_ASSERT_DEBUG(dbgh::channels::_channel_, dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#endif
+
+#define ASSERT_WARNING_CH(_channel_, _expression_, ...)                                                                                 \
+    IMPL_DBGH_ASSERT(dbgh::channels::_channel_, dbgh::EAssertLevel::Warning, _expression_, __VA_ARGS__)
+
+#ifdef DBGH_ASSERTS_NO_ERROR
+#define ASSERT_ERROR_CH(_channel_, _expression_, ...)      IMPL_DBGH_COMPILED_OUT(_expression_)
+#else
+#define ASSERT_ERROR_CH(_channel_, _expression_, ...)                                                                                   \
+    IMPL_DBGH_ASSERT(dbgh::channels::_channel_, dbgh::EAssertLevel::Error, _expression_, __VA_ARGS__)
+#endif
+
+#define ASSERT_FATAL_CH(_channel_, _expression_, ...)                                                                                   \
+    IMPL_DBGH_ASSERT(dbgh::channels::_channel_, dbgh::EAssertLevel::Fatal, _expression_, __VA_ARGS__)
+
+#define ASSERT_AUDIT_CH(_channel_, _expression_, ...)                                                                                   \
+    IMPL_DBGH_ASSERT_SAMPLED(dbgh::channels::_channel_, dbgh::EAssertLevel::Audit, _expression_, __VA_ARGS__)
+
+#define ASSERT_ONCE_CH(_channel_, _expression_, ...)                                                                                    \
+    IMPL_DBGH_ASSERT_LIMITED(dbgh::channels::_channel_, dbgh::EAssertLevel::Warning, IsFirstN, 1, _expression_, __VA_ARGS__)
+
+#define ASSERT_FIRST_N_CH(_channel_, _count_, _expression_, ...)                                                                        \
+    IMPL_DBGH_ASSERT_LIMITED(dbgh::channels::_channel_, dbgh::EAssertLevel::Warning, IsFirstN, _count_, _expression_, __VA_ARGS__)
+
+#define ASSERT_EVERY_N_CH(_channel_, _period_, _expression_, ...)                                                                       \
+    IMPL_DBGH_ASSERT_LIMITED(dbgh::channels::_channel_, dbgh::EAssertLevel::Warning, IsEveryN, _period_, _expression_, __VA_ARGS__)
+
+#else
+
+#define ASSERT_DEBUG_CH(_channel_, _expression_, ...)                                                                                   \
+    IMPL_DBGH_ASSERT_DEBUG(dbgh::channels::_channel_, dbgh::EAssertLevel::Debug, _expression_, __VA_ARGS__)
+#define ASSERT_WARNING_CH(_channel_, _expression_, ...)    ASSERT_DEBUG_CH(_channel_, _expression_, __VA_ARGS__)
+#define ASSERT_ERROR_CH(_channel_, _expression_, ...)      ASSERT_DEBUG_CH(_channel_, _expression_, __VA_ARGS__)
+#define ASSERT_FATAL_CH(_channel_, _expression_, ...)      ASSERT_DEBUG_CH(_channel_, _expression_, __VA_ARGS__)
+#define ASSERT_AUDIT_CH(_channel_, _expression_, ...)      ASSERT_DEBUG_CH(_channel_, _expression_, __VA_ARGS__)
+#define ASSERT_ONCE_CH(_channel_, _expression_, ...)       ASSERT_DEBUG_CH(_channel_, _expression_, __VA_ARGS__)
+#define ASSERT_FIRST_N_CH(_channel_, _count_, _expression_, ...)     ASSERT_DEBUG_CH(_channel_, _expression_, __VA_ARGS__)
+#define ASSERT_EVERY_N_CH(_channel_, _period_, _expression_, ...)    ASSERT_DEBUG_CH(_channel_, _expression_, __VA_ARGS__)
+
+#endif
+
+
+/**
+ * @brief      The async-signal-safe and allocation-free version of \ref ASSERT_FATAL.
+ *              If the argument expression of this macro compares equal to 0 (i.e., the expression is false),
+ *              the assertion information is written by raw write(2) from a preallocated static buffer to the
+ *              fatal descriptor (\ref dbgh::CAssertConfig::SetFatalDescriptor, the standard error by default),
+ *              then std::abort is called. The executor is not used.
+ *
+ * @note       The macro can be used in signal handlers and after the heap corruption, if \ref dbgh::CAssertConfig
+ *              is already created (any assert or configuration call creates it). The message is not formatted,
+ *              it must be a string literal or another null-terminated string. The macro is enabled and disabled
+ *              together with ASSERT_FATAL, and it is the same in the debug mode.
+ *
+ * @example    The use example.
+ *              ASSERT_FATAL_SAFE(header->magic == s_uMagic, "The block header is corrupted.");
+ *
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      _message_     The null-terminated string that will appear as runtime error if the _expression_ is false.
+ */
+#define ASSERT_FATAL_SAFE(_expression_, _message_)                                                                                      \
+    if ( dbgh::impl::CConstantCheck::IsConstantEvaluated() )                                                                            \
+    {                                                                                                                                   \
+        IMPL_DBGH_CONSTANT_CHECK(_expression_, #_expression_, _message_);                                                               \
+    }                                                                                                                                   \
+    else if ( dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Fatal)                                                      \
+              && IMPL_DBGH_PROBE_EVAL(dbgh::EAssertLevel::Fatal) && ! bool(_expression_) )                                              \
+    {                                                                                                                                   \
+        dbgh::impl::CAssertHandler::HandleFatal(_message_, IMPL_DBGH_TEXT(#_expression_), IMPL_DBGH_FILE, __LINE__, __func__);          \
+    }                                                                                                                                   \
+    (void) 0
+
+
+#if defined(DBGH_ASSERTS_NO_ERROR) && ! defined(DEBUG)
+
+/**
+ * @internal
+ * @brief      The range asserts have the ASSERT_ERROR level, they are compiled out together with ASSERT_ERROR.
+ */
+#define IMPL_DBGH_ASSERT_RANGE_LEVEL(_expression_, _text_, ...)    IMPL_DBGH_COMPILED_OUT(_expression_)
+
+#elif ! defined(DEBUG)
+
+/**
+ * @internal
+ * @brief      The helper macro using for the range asserts, the range asserts have the ASSERT_ERROR level.
+ */
+#define IMPL_DBGH_ASSERT_RANGE_LEVEL(_expression_, _text_, ...)                                                                         \
+    IMPL_DBGH_ASSERT_TEXT(dbgh::SChannel { }, dbgh::EAssertLevel::Error, _expression_, _text_, __VA_ARGS__)
+
+#else
+
+#define IMPL_DBGH_ASSERT_RANGE_LEVEL(_expression_, _text_, ...)                                                                         \
+    IMPL_DBGH_ASSERT_DEBUG_TEXT(dbgh::SChannel { }, dbgh::EAssertLevel::Debug, _expression_, _text_, __VA_ARGS__)
 
 #endif
+
+
+/**
+ * @brief      The helper macro using for place code for range asserts in one line.
+ *
+ * @param      _finder_  The call of \ref dbgh::impl::CRangeCheck which returns the index of the first failing element.
+ * @param      _text_    The assertion text which will appear in the assertion information.
+ * @param      _values_  The contiguous range of values.
+ */
+#define IMPL_DBGH_ASSERT_RANGE(_finder_, _text_, _values_)                                                                              \
+    {                                                                                                                                   \
+        std::size_t dbghIndex_ { dbgh::impl::CRangeCheck::npos };                                                                       \
+        IMPL_DBGH_ASSERT_RANGE_LEVEL((dbgh::impl::CRangeCheck::npos == (dbghIndex_ = _finder_)), _text_                                 \
+                                     , "The element at index {} has the value {}."                                                      \
+                                     , dbghIndex_, dbgh::impl::CRangeCheck::ValueAt(_values_, dbghIndex_));                             \
+    }                                                                                                                                   \
+    (void) 0
+
+
+/**
+ * @brief      Checks that all values of the float or double buffer are finite (not NaN and not infinity).
+ *              The buffer is checked by a vectorized kernel (AVX2 or SSE2, selected at runtime), the failure is
+ *              reported as \ref ASSERT_ERROR with the index and the value of the first failing element.
+ *
+ * @example    The use example.
+ *              ASSERT_ALL_FINITE(weights);
+ *
+ * @param      _values_  The contiguous range of values, for example std::vector, std::array or std::span.
+ */
+#define ASSERT_ALL_FINITE(_values_)                                                                                                     \
+    IMPL_DBGH_ASSERT_RANGE(dbgh::impl::CRangeCheck::FindNonFinite(_values_), "ASSERT_ALL_FINITE(" #_values_ ")", _values_)
+
+/**
+ * @brief      Checks that all values of the numeric buffer are in the closed interval [lo, hi].
+ *              The float, double, int32 and int64 buffers are checked by a vectorized kernel, the failure is
+ *              reported as \ref ASSERT_ERROR with the index and the value of the first failing element.
+ *
+ * @example    The use example.
+ *              ASSERT_IN_RANGE(probabilities, 0.0f, 1.0f);
+ *
+ * @param      _values_  The contiguous range of values, for example std::vector, std::array or std::span.
+ * @param      _lo_      The lower bound.
+ * @param      _hi_      The upper bound.
+ */
+#define ASSERT_IN_RANGE(_values_, _lo_, _hi_)                                                                                           \
+    IMPL_DBGH_ASSERT_RANGE(dbgh::impl::CRangeCheck::FindOutOfRange(_values_, _lo_, _hi_)                                                \
+                           , "ASSERT_IN_RANGE(" #_values_ ", " #_lo_ ", " #_hi_ ")", _values_)
+
+/**
+ * @brief      Checks that the numeric buffer is sorted in non-descending order.
+ *              The float, double, int32 and int64 buffers are checked by a vectorized kernel, the failure is
+ *              reported as \ref ASSERT_ERROR with the index and the value of the first element which is less
+ *              than the previous one.
+ *
+ * @example    The use example.
+ *              ASSERT_SORTED(offsets);
+ *
+ * @param      _values_  The contiguous range of values, for example std::vector, std::array or std::span.
+ */
+#define ASSERT_SORTED(_values_)                                                                                                         \
+    IMPL_DBGH_ASSERT_RANGE(dbgh::impl::CRangeCheck::FindUnsorted(_values_), "ASSERT_SORTED(" #_values_ ")", _values_)
+
+/**
+ * @brief      Checks that the buffer of pointers does not contain null pointers.
+ *              The buffer is checked by a vectorized kernel, the failure is reported as \ref ASSERT_ERROR with
+ *              the index of the first null pointer.
+ *
+ * @example    The use example.
+ *              ASSERT_NONE_NULL(rows);
+ *
+ * @param      _values_  The contiguous range of pointers, for example std::vector, std::array or std::span.
+ */
+#define ASSERT_NONE_NULL(_values_)                                                                                                      \
+    IMPL_DBGH_ASSERT_RANGE(dbgh::impl::CRangeCheck::FindNull(_values_), "ASSERT_NONE_NULL(" #_values_ ")", _values_)
+
+/**
+ * @brief      Checks that all elements of the large random access range satisfy the predicate. The range is split
+ *              into chunks which are checked in parallel on the thread pool of the library, all workers stop as soon
+ *              as a failing element is found. The failure is reported as \ref ASSERT_ERROR with the smallest failing
+ *              index, the result does not depend on the scheduling. If the level is disabled, the range is not scanned.
+ *
+ * @note       The predicate is called concurrently from several threads, it must be thread safe and must not throw.
+ *              The size of the thread pool is set by \ref dbgh::CAssertConfig::SetParallelCheckThreads.
+ *
+ * @example    The use example.
+ *              ASSERT_ALL_OF_PAR(records, [](const SRecord& record) { return record.IsValid(); });
+ *
+ * @param      _range_      The random access range, for example std::vector, std::deque or std::span.
+ * @param      _predicate_  The predicate with signature bool(const T&).
+ */
+#define ASSERT_ALL_OF_PAR(_range_, ...)                                                                                                 \
+    {                                                                                                                                   \
+        std::size_t dbghIndex_ { dbgh::impl::CParallelCheck::npos };                                                                    \
+        IMPL_DBGH_ASSERT_RANGE_LEVEL(                                                                                                   \
+                (dbgh::impl::CParallelCheck::npos == (dbghIndex_ = dbgh::impl::CParallelCheck::FindFirstFailure(_range_, __VA_ARGS__))) \
+                , "ASSERT_ALL_OF_PAR(" #_range_ ", " #__VA_ARGS__ ")"                                                                   \
+                , "The element at index {} does not satisfy the predicate.", dbghIndex_);                                               \
+    }                                                                                                                                   \
+    (void) 0
+
+
+/**
+ * @brief      Checks that the pointer points to the readable mapped memory. The check is a binary search in the cached
+ *              index of /proc/self/maps (see \ref dbgh::impl::CAddressMap), no system call is made on the hot path,
+ *              the index is refreshed if the pointer is not found. The failure is reported as \ref ASSERT_ERROR.
+ *
+ * @note       The check catches the wild and the freed to the system pointers, the pointer to the freed heap block
+ *              which is still owned by the allocator passes. On the platforms without /proc/self/maps only the null
+ *              pointer is detected.
+ *
+ * @example    The use example.
+ *              ASSERT_VALID_PTR(pHeader);
+ *
+ * @param      _pointer_  The pointer.
+ */
+#define ASSERT_VALID_PTR(_pointer_)                                                                                                     \
+    {                                                                                                                                   \
+        const volatile void* dbghPointer_ { nullptr };                                                                                  \
+        IMPL_DBGH_ASSERT_RANGE_LEVEL(dbgh::impl::CAddressMap::IsReadable(dbghPointer_ = (_pointer_), 1)                                 \
+                                     , "ASSERT_VALID_PTR(" #_pointer_ ")"                                                               \
+                                     , "The pointer {} is not mapped.", const_cast<const void*>(dbghPointer_));                         \
+    }                                                                                                                                   \
+    (void) 0
+
+/**
+ * @brief      Checks that the bytes [pointer, pointer + size) are in one readable mapped region, as
+ *              \ref ASSERT_VALID_PTR does for one byte. The failure is reported as \ref ASSERT_ERROR.
+ *
+ * @example    The use example.
+ *              ASSERT_READABLE(pPacket, uPacketSize);
+ *
+ * @param      _pointer_  The pointer to the first byte.
+ * @param      _size_     The count of bytes.
+ */
+#define ASSERT_READABLE(_pointer_, _size_)                                                                                              \
+    {                                                                                                                                   \
+        const volatile void* dbghPointer_ { nullptr };                                                                                  \
+        std::size_t dbghSize_ { 0 };                                                                                                    \
+        IMPL_DBGH_ASSERT_RANGE_LEVEL(dbgh::impl::CAddressMap::IsReadable(dbghPointer_ = (_pointer_), dbghSize_ = (_size_))              \
+                                     , "ASSERT_READABLE(" #_pointer_ ", " #_size_ ")"                                                   \
+                                     , "The {} bytes at {} are not readable.", dbghSize_, const_cast<const void*>(dbghPointer_));       \
+    }                                                                                                                                   \
+    (void) 0
+
+
+/**
+ * @brief      The helper macro using for place code for deferred asserts in one line.
+ *
+ * @param      _channel_     The channel, \ref dbgh::SChannel.
+ * @param      _level_       The assert level.
+ * @param      _snapshot_    The trivially copyable snapshot which is copied into the queue.
+ * @param      _predicate_   The trivially copyable predicate with signature bool(const TSnapshot&).
+ * @param      ...           The format string literal and the trivially copyable args for formating.
+ */
+#define IMPL_DBGH_ASSERT_DEFERRED(_channel_, _level_, _snapshot_, _predicate_, ...)                                                     \
+    {                                                                                                                                   \
+        static constinit dbgh::impl::SAssertSite dbghSite_ {                                                                            \
+                _level_, IMPL_DBGH_TEXT(#_predicate_ "(" #_snapshot_ ")"), IMPL_DBGH_FILE, __LINE__, __func__ };                        \
+        if ( dbgh::CAssertConfig::Get().IsActiveAssert(_channel_, _level_) )                                                            \
+        {                                                                                                                               \
+            dbgh::CDeferredVerifier::Enqueue<_level_>(dbghSite_, _snapshot_, _predicate_, __VA_ARGS__);                                 \
+        }                                                                                                                               \
+    }                                                                                                                                   \
+    (void) 0
+
+#ifndef DEBUG
+
+/**
+ * @brief      The deferred assert for the invariants which are pure functions of a small snapshot, for example a
+ *              copied header struct or a checksum over immutable data. The asserting thread only copies the snapshot,
+ *              the predicate and the format arguments into a preallocated slot of the lock-free queue, the predicate
+ *              is evaluated on the background verifier thread. If the predicate returns false, the failure is reported
+ *              through the handler of the given level with the file, line and function of the assert.
+ *
+ * @note       The snapshot, the predicate and the format arguments must be trivially copyable and not larger than
+ *              \ref dbgh::CDeferredVerifier::s_uPayloadSize bytes together. The format string must be a string literal,
+ *              it is checked against the arguments at compile time as in the other asserts.
+ *              If the queue is full, the check is dropped, see \ref dbgh::CDeferredVerifier::GetDroppedCount.
+ *              The ASSERT_ERROR exception is not thrown, because there is no caller on the verifier thread.
+ *
+ * @example    The use example.
+ *              ASSERT_DEFERRED(dbgh::EAssertLevel::Error, header, IsValidHeader, "The header of page {} is corrupted.", pageId);
+ *
+ * @param      _level_       The assert level.
+ * @param      _snapshot_    The trivially copyable snapshot which is copied into the queue.
+ * @param      _predicate_   The trivially copyable predicate with signature bool(const TSnapshot&).
+ * @param      ...           The format string literal and the trivially copyable args for formating.
+ */
+#define ASSERT_DEFERRED(_level_, _snapshot_, _predicate_, ...)                                                                          \
+    IMPL_DBGH_ASSERT_DEFERRED(dbgh::SChannel { }, _level_, _snapshot_, _predicate_, __VA_ARGS__)
+
+
+/**
+ * @brief      The same as \ref ASSERT_DEFERRED, but the assert belongs to the channel declared by \ref DBGH_CHANNEL.
+ *              The level is checked against the enabled levels of the channel on the asserting thread.
+ *
+ * @param      _channel_     The name of the channel.
+ * @param      _level_       The assert level.
+ * @param      _snapshot_    The trivially copyable snapshot which is copied into the queue.
+ * @param      _predicate_   The trivially copyable predicate with signature bool(const TSnapshot&).
+ * @param      ...           The format string literal and the trivially copyable args for formating.
+ */
+#define ASSERT_DEFERRED_CH(_channel_, _level_, _snapshot_, _predicate_, ...)                                                            \
+    IMPL_DBGH_ASSERT_DEFERRED(dbgh::channels::_channel_, _level_, _snapshot_, _predicate_, __VA_ARGS__)
+
+#else
+
+#define ASSERT_DEFERRED(_level_, _snapshot_, _predicate_, ...)                                                                          \
+    IMPL_DBGH_ASSERT_DEFERRED(dbgh::SChannel { }, dbgh::EAssertLevel::Debug, _snapshot_, _predicate_, __VA_ARGS__)
+
+
+#define ASSERT_DEFERRED_CH(_channel_, _level_, _snapshot_, _predicate_, ...)                                                            \
+    IMPL_DBGH_ASSERT_DEFERRED(dbgh::channels::_channel_, dbgh::EAssertLevel::Debug, _snapshot_, _predicate_, __VA_ARGS__)
+
+#endif
+
+
+#ifndef DEBUG
+
+/**
+ * @brief      The assert for the expensive invariants which need to be checked only every so often, for example
+ *              a heap consistency walk. The expression is evaluated at most once per interval per site, by one of
+ *              the threads which execute the site. The failure is reported through the handler of the given level.
+ *              The skip path reads the coarse monotonic clock once (CLOCK_MONOTONIC_COARSE on Linux, without
+ *              a system call) and compares it with the deadline of the site.
+ *
+ * @example    The use example.
+ *              ASSERT_PERIODIC(dbgh::EAssertLevel::Error, std::chrono::seconds { 1 }, heap.IsConsistent(), "The heap is corrupted.");
+ *
+ * @param      _level_       The assert level.
+ * @param      _interval_    The std::chrono duration, the minimal interval between the evaluations.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define ASSERT_PERIODIC(_level_, _interval_, _expression_, ...)                                                                         \
+    IMPL_DBGH_ASSERT_PERIODIC(dbgh::SChannel { }, _level_, _interval_, _expression_, __VA_ARGS__)
+
+
+/**
+ * @brief      The same as \ref ASSERT_PERIODIC, but the assert belongs to the channel declared by \ref DBGH_CHANNEL.
+ *
+ * @param      _channel_     The name of the channel.
+ * @param      _level_       The assert level.
+ * @param      _interval_    The std::chrono duration, the minimal interval between the evaluations.
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, this causes an assertion failure.
+ * @param      ...           The string and args for formating will appear as a runtime error if the _expression_ is false.
+ */
+#define ASSERT_PERIODIC_CH(_channel_, _level_, _interval_, _expression_, ...)                                                           \
+    IMPL_DBGH_ASSERT_PERIODIC(dbgh::channels::_channel_, _level_, _interval_, _expression_, __VA_ARGS__)
+
+
+#else
+
+#define ASSERT_PERIODIC(_level_, _interval_, _expression_, ...)                                                                         \
+    IMPL_DBGH_ASSERT_PERIODIC(dbgh::SChannel { }, dbgh::EAssertLevel::Debug, _interval_, _expression_, __VA_ARGS__)
+
+
+#define ASSERT_PERIODIC_CH(_channel_, _level_, _interval_, _expression_, ...)                                                           \
+    IMPL_DBGH_ASSERT_PERIODIC(dbgh::channels::_channel_, dbgh::EAssertLevel::Debug, _interval_, _expression_, __VA_ARGS__)
+
+
+#endif
+
+
+/**
+ * @brief      Attaches the key and the value to the assertion reports of the current thread until the end of the scope.
+ *              The scope only stores the key pointer and the raw value into a fixed-size thread-local stack, without
+ *              allocations and formatting. The stack is rendered into the assertion information only on failure.
+ *
+ * @note       The key and the string values are stored as pointers, they must outlive the scope.
+ *
+ * @example    The use example.
+ *              DBGH_CONTEXT("shard", shardId);
+ *              DBGH_CONTEXT("request", request.Id());
+ *
+ * @param      _key_    The key, usually a string literal.
+ * @param      _value_  The integer, floating point, bool, enum, string or pointer value.
+ */
+#define DBGH_CONTEXT(_key_, _value_)                                                                                                    \
+    const dbgh::CAssertContext IMPL_DBGH_CONCAT(dbghContext_, __LINE__) { _key_, _value_ }
+
+
+/**
+ * @internal
+ * @brief      The level of \ref DBGH_VERIFY, the level of ASSERT_ERROR: Error, or Debug in debug mode.
+ */
+#ifndef DEBUG
+#define IMPL_DBGH_VERIFY_LEVEL    dbgh::EAssertLevel::Error
+#else
+#define IMPL_DBGH_VERIFY_LEVEL    dbgh::EAssertLevel::Debug
+#endif
+
+
+/**
+ * @brief      Verifies the recoverable invariant and returns the failure as a value, the result is \ref dbgh::TVerified
+ *              (std::expected<void, dbgh::SAssertError> if it is available). The verification shares the level of
+ *              ASSERT_ERROR (Debug in debug mode): if the level is disabled, the expression is not evaluated and
+ *              the result is the success. The failure is reported through \ref dbgh::CHandlerExecutor::HandleVerify,
+ *              nothing is thrown.
+ *
+ * @note       The site descriptor is created on the first failure, the successful verification costs as much as
+ *              the passed ASSERT_ERROR.
+ *
+ * @example    The use example.
+ *              if (const auto verified = DBGH_VERIFY(size <= capacity, "The size {} is out of capacity.", size); ! verified)
+ *              {
+ *                  return Reject(verified.error().Expression());
+ *              }
+ *
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, the failure is returned.
+ * @param      ...           The string and args for formating will appear in the report if the _expression_ is false.
+ */
+#if defined(DBGH_ASSERTS_NO_ERROR) && ! defined(DEBUG)
+#define DBGH_VERIFY(_expression_, ...)    (IMPL_DBGH_COMPILED_OUT(_expression_), dbgh::TVerified { })
+#else
+#define DBGH_VERIFY(_expression_, ...)                                                                                                  \
+    ( ( ! dbgh::CAssertConfig::Get().IsActiveAssert(IMPL_DBGH_VERIFY_LEVEL)                                                             \
+        || ! IMPL_DBGH_PROBE_EVAL(IMPL_DBGH_VERIFY_LEVEL)                                                                               \
+        || IMPL_DBGH_EVALUATE(IMPL_DBGH_VERIFY_LEVEL, _expression_, #_expression_) )                                                    \
+      ? dbgh::TVerified { }                                                                                                             \
+      : dbgh::TVerified { dbgh::impl::CVerifier::Fail([](const char* dbghFunction_) -> dbgh::impl::SAssertSite& {                       \
+            static dbgh::impl::SAssertSite dbghVerified_ {                                                                              \
+                    IMPL_DBGH_VERIFY_LEVEL, IMPL_DBGH_TEXT(#_expression_), IMPL_DBGH_FILE, __LINE__, dbghFunction_ };                   \
+            return dbghVerified_;                                                                                                       \
+        }(__func__), [&]() { return std::format(__VA_ARGS__); }) } )
+#endif
+
+
+/**
+ * @brief      Verifies the recoverable invariant as \ref DBGH_VERIFY does, on failure returns
+ *              \ref dbgh::TUnexpected from the enclosing function. The function must return std::expected<T, dbgh::SAssertError>
+ *              (only \ref dbgh::TVerified if std::expected is not available).
+ *
+ * @example    The use example.
+ *              dbgh::TVerified Parse(const SRequest& request)
+ *              {
+ *                  DBGH_VERIFY_OR_RETURN(request.m_uSize <= s_uMaxSize, "The request size {} is too big.", request.m_uSize);
+ *                  ...
+ *                  return { };
+ *              }
+ *
+ * @param      _expression_  Expression to be evaluated. If this expression evaluates to false, the failure is returned.
+ * @param      ...           The string and args for formating will appear in the report if the _expression_ is false.
+ */
+#define DBGH_VERIFY_OR_RETURN(_expression_, ...)                                                                                        \
+    if ( const dbgh::TVerified dbghVerifiedResult_ = DBGH_VERIFY(_expression_, __VA_ARGS__); ! dbghVerifiedResult_.has_value() )        \
+    {                                                                                                                                   \
+        return dbgh::TUnexpected { dbghVerifiedResult_.error() };                                                                       \
+    }                                                                                                                                   \
+    (void) 0
@@ -0,0 +1,386 @@
+/**
+ * @file        DBGHCheckedSpan.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CCheckedSpan and CCheckedVectorView classes.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "DBGHAssert.h"
+
+
+/**
+ * @internal
+ * @brief      The helper macro using for the bounds checks of the checked views, asserts the expression with the
+ *              assert of the given level. The level is the template parameter of the view, the other branches are
+ *              discarded, so the compiled out level (DBGH_ASSERTS_NO_DEBUG, DBGH_ASSERTS_NO_ERROR) leaves no code.
+ *
+ * @param      _level_       The assert level, Debug, Warning, Error or Fatal.
+ * @param      _expression_  Expression to be evaluated.
+ * @param      ...           The string and args for formating.
+ */
+#define IMPL_DBGH_ASSERT_BOUNDS(_level_, _expression_, ...)                                                                             \
+    if constexpr (dbgh::EAssertLevel::Debug == (_level_))                                                                               \
+    {                                                                                                                                   \
+        ASSERT_DEBUG(_expression_, __VA_ARGS__);                                                                                        \
+    }                                                                                                                                   \
+    else if constexpr (dbgh::EAssertLevel::Warning == (_level_))                                                                        \
+    {                                                                                                                                   \
+        ASSERT_WARNING(_expression_, __VA_ARGS__);                                                                                      \
+    }                                                                                                                                   \
+    else if constexpr (dbgh::EAssertLevel::Error == (_level_))                                                                          \
+    {                                                                                                                                   \
+        ASSERT_ERROR(_expression_, __VA_ARGS__);                                                                                        \
+    }                                                                                                                                   \
+    else                                                                                                                                \
+    {                                                                                                                                   \
+        ASSERT_FATAL(_expression_, __VA_ARGS__);                                                                                        \
+    }                                                                                                                                   \
+    (void) 0
+
+
+namespace dbgh
+{
+
+/**
+ * @class      CCheckedSpan
+ * @brief      The std::span with the bounds checks at the assert level given by the template parameter.
+ *
+ * @details    The element access (operator[], front, back) asserts that the index is in the span. The loops should use
+ *              \ref for_each_checked and \ref subspan_checked, they check the whole index range once before the loop,
+ *              the loop itself is the plain loop over the pointer and is vectorized as the loop over std::span.
+ *              If the level is compiled out, the view is the same code as std::span. After the failed check which
+ *              does not terminate or throw (ASSERT_WARNING, the custom executor), the access is done as std::span does.
+ *
+ * @example    dbgh::CCheckedSpan<const float> weights { vecWeights };
+ *             const auto first = weights[0];
+ *             weights.subspan_checked(offset, count).for_each_checked([&sum](const float weight) { sum += weight; });
+ *
+ * @tparam     T      The type of the elements.
+ * @tparam     Level  The assert level of the bounds checks, Debug, Warning, Error or Fatal.
+ */
+template <typename T, EAssertLevel Level = EAssertLevel::Error>
+class CCheckedSpan
+{
+    static_assert(EAssertLevel::Debug == Level || EAssertLevel::Warning == Level
+                  || EAssertLevel::Error == Level || EAssertLevel::Fatal == Level
+                  , "The bounds checks support the Debug, Warning, Error and Fatal levels.");
+
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = typename std::span<T>::iterator;
+
+    constexpr CCheckedSpan() noexcept = default;
+
+    constexpr CCheckedSpan(pointer data, const size_type size) noexcept
+            : m_span { data, size }
+    { }
+
+    template <typename TRange>
+        requires (! std::is_same_v<std::remove_cvref_t<TRange>, CCheckedSpan>)
+                 && std::is_constructible_v<std::span<T>, TRange>
+    constexpr CCheckedSpan(TRange&& range) noexcept
+            : m_span { std::forward<TRange>(range) }
+    { }
+
+    /**
+     * @brief      Gets the unchecked view.
+     */
+    [[nodiscard]] constexpr std::span<T> unchecked() const noexcept
+    {
+        return m_span;
+    }
+
+    constexpr operator std::span<T>() const noexcept
+    {
+        return m_span;
+    }
+
+    /**
+     * @brief      Gets the element, asserts that the index is less than size().
+     */
+    [[nodiscard]] constexpr reference operator[](const size_type index) const
+    {
+        IMPL_DBGH_ASSERT_BOUNDS(Level, index < m_span.size(), "The index {} is out of the span of size {}.", index, m_span.size());
+        return m_span[index];
+    }
+
+    /**
+     * @brief      Gets the first element, asserts that the span is not empty.
+     */
+    [[nodiscard]] constexpr reference front() const
+    {
+        IMPL_DBGH_ASSERT_BOUNDS(Level, ! m_span.empty(), "The front of the empty span.");
+        return m_span.front();
+    }
+
+    /**
+     * @brief      Gets the last element, asserts that the span is not empty.
+     */
+    [[nodiscard]] constexpr reference back() const
+    {
+        IMPL_DBGH_ASSERT_BOUNDS(Level, ! m_span.empty(), "The back of the empty span.");
+        return m_span.back();
+    }
+
+    /**
+     * @brief      Gets the subspan [offset, offset + count), asserts once that it is in the span.
+     *
+     * @param[in]  offset  The index of the first element.
+     * @param[in]  count   The count of elements, by default up to the end of the span.
+     *
+     * @return     The checked subspan with the same level.
+     */
+    [[nodiscard]] constexpr CCheckedSpan subspan_checked(
+            const size_type offset, const size_type count = std::dynamic_extent) const
+    {
+        IMPL_DBGH_ASSERT_BOUNDS(Level, offset <= m_span.size() && (std::dynamic_extent == count || count <= m_span.size() - offset)
+                                , "The subspan at {} of {} elements is out of the span of size {}.", offset, count, m_span.size());
+        return CCheckedSpan { m_span.subspan(offset, count) };
+    }
+
+    /**
+     * @brief      Calls the function for each element of [first, last), asserts once that the range is in the span.
+     *              The loop has no checks.
+     *
+     * @param[in]  first     The index of the first element.
+     * @param[in]  last      The index past the last element.
+     * @param[in]  function  The function with signature void(T&).
+     */
+    template <typename TFunction>
+    constexpr void for_each_checked(const size_type first, const size_type last, TFunction&& function) const
+    {
+        IMPL_DBGH_ASSERT_BOUNDS(Level, first <= last && last <= m_span.size()
+                                , "The range [{}, {}) is out of the span of size {}.", first, last, m_span.size());
+        pointer const data = m_span.data();
+        for (size_type index = first; index < last; ++index)
+        {
+            function(data[index]);
+        }
+    }
+
+    /**
+     * @brief      Calls the function for each element of the span, the loop has no checks.
+     *
+     * @param[in]  function  The function with signature void(T&).
+     */
+    template <typename TFunction>
+    constexpr void for_each_checked(TFunction&& function) const
+    {
+        for (reference element : m_span)
+        {
+            function(element);
+        }
+    }
+
+    [[nodiscard]] constexpr pointer data() const noexcept
+    {
+        return m_span.data();
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return m_span.size();
+    }
+
+    [[nodiscard]] constexpr size_type size_bytes() const noexcept
+    {
+        return m_span.size_bytes();
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return m_span.empty();
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept
+    {
+        return m_span.begin();
+    }
+
+    [[nodiscard]] constexpr iterator end() const noexcept
+    {
+        return m_span.end();
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      The viewed elements.
+     */
+    std::span<T> m_span;
+};
+
+template <typename T>
+CCheckedSpan(T*, std::size_t) -> CCheckedSpan<T>;
+
+template <typename TRange>
+CCheckedSpan(TRange&&) -> CCheckedSpan<std::remove_reference_t<std::ranges::range_reference_t<TRange>>>;
+
+
+/**
+ * @class      CCheckedVectorView
+ * @brief      The view of std::vector with the bounds checks at the assert level given by the template parameter.
+ *
+ * @details    Unlike \ref CCheckedSpan the view refers to the vector itself, not to its buffer, so the checks use the
+ *              current size and the view stays valid after the vector is resized. The loop helpers are the same as
+ *              of \ref CCheckedSpan.
+ *
+ * @example    dbgh::CCheckedVectorView<int> view { vecOffsets };
+ *             vecOffsets.push_back(42);
+ *             view[view.size() - 1] = 0;
+ *
+ * @tparam     T           The type of the elements, const for the view of the const vector.
+ * @tparam     Level       The assert level of the bounds checks, Debug, Warning, Error or Fatal.
+ * @tparam     TAllocator  The allocator of the vector.
+ */
+template <typename T, EAssertLevel Level = EAssertLevel::Error, typename TAllocator = std::allocator<std::remove_cv_t<T>>>
+class CCheckedVectorView
+{
+public:
+    using vector_type = std::conditional_t<std::is_const_v<T>
+                                           , const std::vector<std::remove_cv_t<T>, TAllocator>
+                                           , std::vector<T, TAllocator>>;
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = typename CCheckedSpan<T, Level>::iterator;
+
+    constexpr CCheckedVectorView(vector_type& vector) noexcept
+            : m_pVector { std::addressof(vector) }
+    { }
+
+    CCheckedVectorView(std::remove_const_t<vector_type>&&) = delete;
+
+    /**
+     * @brief      Gets the checked span of the current elements of the vector.
+     */
+    [[nodiscard]] constexpr CCheckedSpan<T, Level> span() const noexcept
+    {
+        return CCheckedSpan<T, Level> { m_pVector->data(), m_pVector->size() };
+    }
+
+    /**
+     * @brief      Gets the element, asserts that the index is less than size().
+     */
+    [[nodiscard]] constexpr reference operator[](const size_type index) const
+    {
+        IMPL_DBGH_ASSERT_BOUNDS(Level, index < m_pVector->size(), "The index {} is out of the vector of size {}."
+                                , index, m_pVector->size());
+        return m_pVector->data()[index];
+    }
+
+    /**
+     * @brief      Gets the first element, asserts that the vector is not empty.
+     */
+    [[nodiscard]] constexpr reference front() const
+    {
+        return span().front();
+    }
+
+    /**
+     * @brief      Gets the last element, asserts that the vector is not empty.
+     */
+    [[nodiscard]] constexpr reference back() const
+    {
+        return span().back();
+    }
+
+    /**
+     * @brief      Gets the subspan [offset, offset + count), see \ref CCheckedSpan::subspan_checked.
+     */
+    [[nodiscard]] constexpr CCheckedSpan<T, Level> subspan_checked(
+            const size_type offset, const size_type count = std::dynamic_extent) const
+    {
+        return span().subspan_checked(offset, count);
+    }
+
+    /**
+     * @brief      Calls the function for each element of [first, last), see \ref CCheckedSpan::for_each_checked.
+     */
+    template <typename TFunction>
+    constexpr void for_each_checked(const size_type first, const size_type last, TFunction&& function) const
+    {
+        span().for_each_checked(first, last, std::forward<TFunction>(function));
+    }
+
+    /**
+     * @brief      Calls the function for each element of the vector, the loop has no checks.
+     */
+    template <typename TFunction>
+    constexpr void for_each_checked(TFunction&& function) const
+    {
+        span().for_each_checked(std::forward<TFunction>(function));
+    }
+
+    [[nodiscard]] constexpr pointer data() const noexcept
+    {
+        return m_pVector->data();
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return m_pVector->size();
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return m_pVector->empty();
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept
+    {
+        return span().begin();
+    }
+
+    [[nodiscard]] constexpr iterator end() const noexcept
+    {
+        return span().end();
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      The viewed vector.
+     */
+    vector_type* m_pVector;
+};
+
+template <typename T, typename TAllocator>
+CCheckedVectorView(std::vector<T, TAllocator>&) -> CCheckedVectorView<T, EAssertLevel::Error, TAllocator>;
+
+template <typename T, typename TAllocator>
+CCheckedVectorView(const std::vector<T, TAllocator>&) -> CCheckedVectorView<const T, EAssertLevel::Error, TAllocator>;
+
+
+/**
+ * @brief      The std-style name of \ref CCheckedSpan.
+ */
+template <typename T, EAssertLevel Level = EAssertLevel::Error>
+using checked_span = CCheckedSpan<T, Level>;
+
+/**
+ * @brief      The std-style name of \ref CCheckedVectorView.
+ */
+template <typename T, EAssertLevel Level = EAssertLevel::Error, typename TAllocator = std::allocator<std::remove_cv_t<T>>>
+using checked_vector_view = CCheckedVectorView<T, Level, TAllocator>;
+
+} // namespace dbgh
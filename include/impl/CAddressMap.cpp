@@ -0,0 +1,293 @@
+/**
+ * @file        CAddressMap.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CAddressMap class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "CAddressMap.h"
+#include "CAssertException.h"
+#include "CAssertLimiter.h"
+
+namespace dbgh::impl
+{
+
+#ifdef __linux__
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      The sorted array of the readable regions, the begin and the end of each region.
+ *
+ * @details    The elements are atomic, so the reader which races with the writer reads torn data without the
+ *              undefined behavior, the sequence counter tells it to repeat the search.
+ */
+struct SRegionTable
+{
+    explicit SRegionTable(const std::size_t capacity)
+            : m_uCapacity { capacity }
+            , m_arrBounds { std::make_unique<std::atomic<std::uintptr_t>[]>(2 * capacity) }
+    { }
+
+    const std::size_t m_uCapacity;
+
+    std::atomic<std::size_t> m_uCount { 0 };
+
+    const std::unique_ptr<std::atomic<std::uintptr_t>[]> m_arrBounds;
+};
+
+/**
+ * @internal
+ * @brief      The current table, the replaced tables are never freed.
+ */
+constinit std::atomic<SRegionTable*> s_pTable { nullptr };
+
+/**
+ * @internal
+ * @brief      The sequence counter of the table, odd while the table is rewritten.
+ */
+constinit std::atomic<std::uint64_t> s_uSequence { 0 };
+
+/**
+ * @internal
+ * @brief      The coarse time in nanoseconds of the next periodic refresh.
+ */
+constinit std::atomic<std::uint64_t> s_uNextRefresh { 0 };
+
+/**
+ * @internal
+ * @brief      The interval of the periodic refresh in nanoseconds, zero if it is disabled.
+ */
+constinit std::atomic<std::uint64_t> s_uRefreshInterval { 1'000'000'000 };
+
+/**
+ * @internal
+ * @brief      The coarse time in nanoseconds of the last refresh caused by a missed range.
+ */
+constinit std::atomic<std::uint64_t> s_uLastMissRefresh { 0 };
+
+/**
+ * @internal
+ * @brief      The mutex of the writers.
+ */
+std::mutex s_mtxRefresh;
+
+/**
+ * @internal
+ * @brief      Reads the merged readable regions from /proc/self/maps.
+ */
+std::vector<std::uintptr_t> ReadRegions()
+{
+    std::vector<std::uintptr_t> vecBounds;
+    auto* file = std::fopen("/proc/self/maps", "r");
+    if (nullptr == file)
+    {
+        return vecBounds;
+    }
+    char arrLine[512];
+    while (nullptr != std::fgets(arrLine, sizeof(arrLine), file))
+    {
+        if (nullptr == std::strchr(arrLine, '\n'))
+        {
+            // The tail of the long line (the path) is not needed.
+            for (int c = std::fgetc(file); EOF != c && '\n' != c; c = std::fgetc(file))
+            { }
+        }
+        std::uintptr_t begin = 0;
+        std::uintptr_t end = 0;
+        char arrPermissions[5] { };
+        if (3 != std::sscanf(arrLine, "%" SCNxPTR "-%" SCNxPTR " %4s", &begin, &end, arrPermissions)
+            || 'r' != arrPermissions[0])
+        {
+            continue;
+        }
+        if (! vecBounds.empty() && vecBounds.back() == begin)
+        {
+            vecBounds.back() = end;
+            continue;
+        }
+        vecBounds.push_back(begin);
+        vecBounds.push_back(end);
+    }
+    std::fclose(file);
+    return vecBounds;
+}
+
+/**
+ * @internal
+ * @brief      Rereads the regions and publishes them, only one thread does it at a time.
+ *
+ * @param[in]  now   The coarse time in nanoseconds.
+ * @param[in]  wait  True if the thread waits for another refreshing thread, False if it skips the refresh.
+ */
+void RefreshTable(const std::uint64_t now, const bool wait) noexcept
+{
+    std::unique_lock lock { s_mtxRefresh, std::defer_lock };
+    if (wait)
+    {
+        lock.lock();
+    }
+    else if (! lock.try_lock())
+    {
+        return;
+    }
+
+    IMPL_DBGH_TRY
+    {
+        const auto vecBounds = ReadRegions();
+        const auto count = vecBounds.size() / 2;
+        auto* table = s_pTable.load(std::memory_order_relaxed);
+        if (nullptr == table || table->m_uCapacity < count)
+        {
+            // The readers of the old table still see the consistent, only stale, regions.
+            table = new SRegionTable { std::max<std::size_t>(256, 2 * count) };
+            for (std::size_t i = 0; i < vecBounds.size(); ++i)
+            {
+                table->m_arrBounds[i].store(vecBounds[i], std::memory_order_relaxed);
+            }
+            table->m_uCount.store(count, std::memory_order_relaxed);
+            s_pTable.store(table, std::memory_order_release);
+        }
+        else
+        {
+            const auto sequence = s_uSequence.load(std::memory_order_relaxed);
+            s_uSequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (std::size_t i = 0; i < vecBounds.size(); ++i)
+            {
+                table->m_arrBounds[i].store(vecBounds[i], std::memory_order_relaxed);
+            }
+            table->m_uCount.store(count, std::memory_order_relaxed);
+            s_uSequence.store(sequence + 2, std::memory_order_release);
+        }
+        s_uNextRefresh.store(now + s_uRefreshInterval.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    IMPL_DBGH_CATCH(...)
+    {
+    }
+}
+
+/**
+ * @internal
+ * @brief      Searches the region which contains [begin, end) in the current table, lock-free.
+ */
+bool Contains(const std::uintptr_t begin, const std::uintptr_t end) noexcept
+{
+    for (;;)
+    {
+        const auto sequence = s_uSequence.load(std::memory_order_acquire);
+        const auto* table = s_pTable.load(std::memory_order_acquire);
+        if (nullptr == table)
+        {
+            return false;
+        }
+        if (0 != (sequence & 1U))
+        {
+            continue;
+        }
+
+        // The first region which begins after the begin, the previous region is the only candidate.
+        std::size_t low = 0;
+        std::size_t high = std::min(table->m_uCount.load(std::memory_order_relaxed), table->m_uCapacity);
+        while (low < high)
+        {
+            const auto middle = low + (high - low) / 2;
+            if (table->m_arrBounds[2 * middle].load(std::memory_order_relaxed) <= begin)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        const bool bFound = 0 != low && end <= table->m_arrBounds[2 * low - 1].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence == s_uSequence.load(std::memory_order_relaxed))
+        {
+            return bFound;
+        }
+    }
+}
+
+} // unnamed namespace
+
+bool CAddressMap::IsReadable(const volatile void* pointer, const std::size_t size) noexcept
+{
+    if (nullptr == pointer)
+    {
+        return false;
+    }
+    const auto begin = reinterpret_cast<std::uintptr_t>(pointer);
+    const auto end = begin + std::max<std::size_t>(1, size);
+    if (end < begin)
+    {
+        return false;
+    }
+
+    const auto now = CAssertLimiter::CoarseNow();
+    const bool bEmpty = nullptr == s_pTable.load(std::memory_order_acquire);
+    if (bEmpty || (0 != s_uRefreshInterval.load(std::memory_order_relaxed)
+                   && now >= s_uNextRefresh.load(std::memory_order_relaxed)))
+    {
+        RefreshTable(now, bEmpty);
+    }
+    if (Contains(begin, end))
+    {
+        return true;
+    }
+    // The region can be mapped after the last refresh. The repeated misses, for example a failure storm of one site,
+    // reread the regions at most once per tick of the coarse clock and never wait for another refreshing thread.
+    auto lastMissRefresh = s_uLastMissRefresh.load(std::memory_order_relaxed);
+    if (now == lastMissRefresh
+        || ! s_uLastMissRefresh.compare_exchange_strong(lastMissRefresh, now, std::memory_order_relaxed))
+    {
+        return false;
+    }
+    RefreshTable(now, false);
+    return Contains(begin, end);
+}
+
+void CAddressMap::SetRefreshInterval(const std::chrono::milliseconds interval) noexcept
+{
+    s_uRefreshInterval.store(static_cast<std::uint64_t>(std::max<std::chrono::milliseconds::rep>(0, interval.count()))
+                             * 1'000'000, std::memory_order_relaxed);
+}
+
+void CAddressMap::Refresh() noexcept
+{
+    RefreshTable(CAssertLimiter::CoarseNow(), true);
+}
+
+#else
+
+bool CAddressMap::IsReadable(const volatile void* pointer, [[maybe_unused]] const std::size_t size) noexcept
+{
+    return nullptr != pointer;
+}
+
+void CAddressMap::SetRefreshInterval([[maybe_unused]] const std::chrono::milliseconds interval) noexcept
+{
+}
+
+void CAddressMap::Refresh() noexcept
+{
+}
+
+#endif
+
+} // namespace dbgh::impl
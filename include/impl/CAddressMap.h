@@ -0,0 +1,68 @@
+/**
+ * @file        CAddressMap.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CAddressMap class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CAddressMap
+ * @brief      The cached index of the readable regions of the process address space, used by
+ *              \ref ASSERT_VALID_PTR and \ref ASSERT_READABLE.
+ *
+ * @details    The index is the sorted array of the merged readable regions read from /proc/self/maps. The check is
+ *              a binary search over the array, no system call is made. The readers are lock-free: the array is
+ *              rewritten under a sequence counter and the reader repeats the search if the counter is changed.
+ *              The index is refreshed when the checked range is not found (a region can be mapped after the last
+ *              refresh), at most once per tick of the coarse clock, and when the refresh interval is elapsed
+ *              (a region can be unmapped). Only one thread refreshes it at a time, the others do not wait.
+ *              The memory of the replaced arrays is kept, so the readers never touch freed memory. On the platforms without /proc/self/maps only the null pointer is detected.
+ */
+class CAddressMap
+{
+public:
+    CAddressMap() = delete;
+
+    ~CAddressMap() = delete;
+
+    CAddressMap(CAddressMap&&) noexcept = delete;
+
+    CAddressMap(const CAddressMap&) = delete;
+
+    CAddressMap& operator=(CAddressMap&&) = delete;
+
+    CAddressMap& operator=(const CAddressMap&) = delete;
+
+    /**
+     * @brief      Checks that the bytes [pointer, pointer + size) are in one readable mapped region.
+     *
+     * @param[in]  pointer  The pointer.
+     * @param[in]  size     The count of bytes, zero is checked as one.
+     *
+     * @return     True if the range is readable, False otherwise.
+     */
+    [[nodiscard]] static bool IsReadable(const volatile void* pointer, std::size_t size) noexcept;
+
+    /**
+     * @brief      Sets the interval of the periodic refresh of the index, zero disables the periodic refresh.
+     *              By default, one second.
+     */
+    static void SetRefreshInterval(std::chrono::milliseconds interval) noexcept;
+
+    /**
+     * @brief      Rereads /proc/self/maps now.
+     */
+    static void Refresh() noexcept;
+};
+
+} // namespace dbgh::impl
@@ -6,21 +6,43 @@
  * @copyright   Copyright (c) 2020
  */
 
+#include <cstdlib>
 #include <stdexcept>
 
 #include "CAssertConfig.h"
+#include "CAssertGovernor.h"
+#include "CAssertHandler.h"
+#include "CAssertSite.h"
+#include "CCircuitBreaker.h"
+#include "CCrashHandler.h"
+#include "CSafeWriter.h"
+#include "CSharedStats.h"
 
 namespace dbgh
 {
 
 CAssertConfig::CAssertConfig()
-        : m_arrEnableFlags {
-        true,    // Warning default value.
-        true,    // Debug default value.
-        true,    // Error default value.
-        false }, // Fatal default value.
+        : m_uLevels { LevelMask(EAssertLevel::Warning, EAssertLevel::Debug, EAssertLevel::Error, EAssertLevel::Audit) },
+    m_arrChannelLevels { },
+    m_arrChannelNames { },
+    m_arrSamplingRates {
+        1,       // Warning default value.
+        1,       // Debug default value.
+        1,       // Error default value.
+        1,       // Fatal default value.
+        100 },   // Audit default value.
+    m_uParallelCheckThreads { 0 },
+    m_eHeadlessAction { EAssertAction::Ignore },
+    m_iPromptTimeout { 0 },
     m_pHandlerExecutor { std::make_unique<dbgh::CHandlerExecutor>() }
-{ }
+{
+    // Fatal is disabled by default, globally.
+    for (auto& levels : m_arrChannelLevels)
+    {
+        levels.store(~TLevelMask { 0 }, std::memory_order_relaxed);
+    }
+    RegisterChannel(SChannel { });
+}
 
 
 CAssertConfig::~CAssertConfig() = default;
@@ -33,24 +55,179 @@ CAssertConfig& CAssertConfig::Get()
 
 [[maybe_unused]] void CAssertConfig::EnableAsserts(const EAssertLevel level) noexcept
 {
-    m_arrEnableFlags[static_cast<size_t>(level)] = true;
+    m_uLevels.fetch_or(LevelMask(level), std::memory_order_relaxed);
 }
 
 [[maybe_unused]] void CAssertConfig::DisableAsserts(const EAssertLevel level) noexcept
 {
-    m_arrEnableFlags[static_cast<size_t>(level)] = false;
+    m_uLevels.fetch_and(~LevelMask(level), std::memory_order_relaxed);
+}
+
+[[maybe_unused]] void CAssertConfig::SetChannelLevels(const SChannel channel, const TLevelMask levels) noexcept
+{
+    m_arrChannelLevels[channel.m_uIndex].store(levels, std::memory_order_relaxed);
+}
+
+[[maybe_unused]] bool CAssertConfig::SetChannelLevels(const std::string_view name, const TLevelMask levels) noexcept
+{
+    for (std::size_t i = 0; i < SChannel::s_uMaxCount; ++i)
+    {
+        const auto* channelName = m_arrChannelNames[i].load(std::memory_order_acquire);
+        if (nullptr != channelName && name == channelName)
+        {
+            m_arrChannelLevels[i].store(levels, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+TLevelMask CAssertConfig::GetChannelLevels(const SChannel channel) const noexcept
+{
+    return m_arrChannelLevels[channel.m_uIndex].load(std::memory_order_relaxed);
+}
+
+bool CAssertConfig::RegisterChannel(const SChannel channel) noexcept
+{
+    const char* registered = nullptr;
+    return m_arrChannelNames[channel.m_uIndex].compare_exchange_strong(
+                   registered, channel.m_strName, std::memory_order_acq_rel)
+           || std::string_view { registered } == channel.m_strName;
+}
+
+bool CAssertConfig::DeclareChannel(const SChannel channel) noexcept
+{
+    if (RegisterChannel(channel))
+    {
+        return true;
+    }
+    // Called during the static initialization, the standard streams may be not constructed yet.
+    const auto descriptor = GetFatalDescriptor();
+    char arrBuffer[256];
+    {
+        impl::CSafeWriter writer { descriptor < 0 ? 2 : descriptor, arrBuffer, sizeof(arrBuffer) };
+        writer.Write("DBGH_CHANNEL: the channels ").Write(m_arrChannelNames[channel.m_uIndex].load(std::memory_order_acquire))
+              .Write(" and ").Write(channel.m_strName).Write(" have the same index ").WriteUnsigned(channel.m_uIndex)
+              .Write(".\n");
+    }
+    std::abort();
+}
+
+bool CAssertConfig::IsEnabledAssert(const EAssertLevel level) const noexcept
+{
+    return 0 != (m_uLevels.load(std::memory_order_relaxed)
+                 & m_arrChannelLevels[SChannel { }.m_uIndex].load(std::memory_order_relaxed) & LevelMask(level));
+}
+
+[[maybe_unused]] void CAssertConfig::SetSamplingRate(const EAssertLevel level, const std::uint32_t rate) noexcept
+{
+    m_arrSamplingRates[static_cast<size_t>(level)].store(rate, std::memory_order_relaxed);
+}
+
+[[maybe_unused]] std::size_t CAssertConfig::SetSamplingRate(
+        const std::string_view file, const TLine line, const std::uint32_t rate) noexcept
+{
+    return impl::CSiteRegistry::ForEach(file, line, [rate](impl::SAssertSite& site)
+    {
+        site.m_uSamplingRate.store(rate, std::memory_order_relaxed);
+    });
+}
+
+std::uint32_t CAssertConfig::GetSamplingRate(const EAssertLevel level) const noexcept
+{
+    return m_arrSamplingRates[static_cast<size_t>(level)].load(std::memory_order_relaxed);
+}
+
+[[maybe_unused]] void CAssertConfig::SetCpuBudget(const double fraction, const std::chrono::milliseconds window) noexcept
+{
+    impl::CAssertGovernor::SetBudget(fraction, window);
+}
+
+double CAssertConfig::GetCpuBudget() const noexcept
+{
+    return impl::CAssertGovernor::GetBudget();
+}
+
+[[maybe_unused]] void CAssertConfig::SetCircuitBreaker(
+        const EAssertLevel level, const std::uint32_t threshold, const ECircuitAction action
+        , const std::chrono::milliseconds cooldown) noexcept
+{
+    impl::CCircuitBreaker::SetPolicy(level, threshold, action, cooldown);
+}
+
+[[maybe_unused]] void CAssertConfig::SetParallelCheckThreads(const std::size_t count) noexcept
+{
+    m_uParallelCheckThreads.store(count, std::memory_order_relaxed);
+}
+
+std::size_t CAssertConfig::GetParallelCheckThreads() const noexcept
+{
+    return m_uParallelCheckThreads.load(std::memory_order_relaxed);
+}
+
+[[maybe_unused]] void CAssertConfig::SetHeadlessAction(const EAssertAction action) noexcept
+{
+    m_eHeadlessAction.store(action, std::memory_order_relaxed);
+}
+
+EAssertAction CAssertConfig::GetHeadlessAction() const noexcept
+{
+    return m_eHeadlessAction.load(std::memory_order_relaxed);
+}
+
+[[maybe_unused]] void CAssertConfig::SetPromptTimeout(const std::chrono::milliseconds timeout) noexcept
+{
+    m_iPromptTimeout.store(timeout.count(), std::memory_order_relaxed);
+}
+
+std::chrono::milliseconds CAssertConfig::GetPromptTimeout() const noexcept
+{
+    return std::chrono::milliseconds { m_iPromptTimeout.load(std::memory_order_relaxed) };
+}
+
+[[maybe_unused]] void CAssertConfig::SetFatalDescriptor(const int descriptor) noexcept
+{
+    s_iFatalDescriptor.store(descriptor, std::memory_order_relaxed);
+}
+
+int CAssertConfig::GetFatalDescriptor() noexcept
+{
+    return s_iFatalDescriptor.load(std::memory_order_relaxed);
+}
+
+[[maybe_unused]] bool CAssertConfig::InstallCrashHandlers(int descriptor) noexcept
+{
+    if (descriptor < 0)
+    {
+        descriptor = GetFatalDescriptor();
+    }
+    return impl::CCrashHandler::Install(descriptor < 0 ? 2 : descriptor);
+}
+
+[[maybe_unused]] bool CAssertConfig::InstallCrashHandlersForThread() noexcept
+{
+    return impl::CCrashHandler::InstallForThread();
+}
+
+[[maybe_unused]] bool CAssertConfig::EnableSharedStatistics() noexcept
+{
+    return impl::CSharedStats::Enable();
 }
 
-bool CAssertConfig::IsActiveAssert(const EAssertLevel level) const noexcept
+[[maybe_unused]] void CAssertConfig::DisableSharedStatistics() noexcept
 {
-    return m_arrEnableFlags[static_cast<size_t>(level)];
+    impl::CSharedStats::Disable();
 }
 
 [[maybe_unused]] void CAssertConfig::SetExecutor(std::unique_ptr<dbgh::CHandlerExecutor> executor)
 {
     if (nullptr == executor)
     {
+#ifdef DBGH_ASSERTS_EXCEPTIONS
         throw std::invalid_argument { "Executor cannot be null." };
+#else
+        impl::CAssertHandler::HandleFatal("Executor cannot be null.", "nullptr != executor", __FILE__, __LINE__, __func__);
+#endif
     }
     m_pHandlerExecutor = std::move(executor);
 }
@@ -9,8 +9,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <exception>
+#include <string_view>
 
 #include "CHandlerExecutor.h"
 
@@ -43,6 +47,11 @@ enum class EAssertLevel : size_t
      */
     Fatal,
 
+    /**
+     * @brief   The enum value mapped to \ref ASSERT_AUDIT assert.
+     */
+    Audit,
+
     /**
      * @internal
      * @breaf   An enumeration value that indicates the end of the enumeration.
@@ -51,6 +60,101 @@ enum class EAssertLevel : size_t
 };
 
 
+/**
+ * @brief      The set of assert levels, one bit per \ref EAssertLevel.
+ */
+using TLevelMask = std::uint32_t;
+
+/**
+ * @brief      Gets the mask of the given assert levels.
+ *
+ * @example    dbgh::LevelMask(dbgh::EAssertLevel::Warning, dbgh::EAssertLevel::Audit);
+ */
+template <typename... TLevels>
+[[nodiscard, gnu::no_instrument_function]] constexpr TLevelMask LevelMask(const TLevels... levels) noexcept
+{
+    return (TLevelMask { 0 } | ... | (TLevelMask { 1 } << static_cast<size_t>(levels)));
+}
+
+
+/**
+ * @struct     SChannel
+ * @brief      The assertion channel, a subsystem with its own set of enabled levels.
+ *
+ * @details    The channels are declared by \ref DBGH_CHANNEL with a dense index below \ref s_uMaxCount.
+ *              The default constructed channel is the default channel (the index zero) used by the assert macros
+ *              without the _CH suffix.
+ */
+struct SChannel
+{
+    /**
+     * @brief      The maximal count of the channels, including the default channel.
+     */
+    static constexpr std::size_t s_uMaxCount = 64;
+
+    /**
+     * @brief      The index of the channel.
+     */
+    std::size_t m_uIndex { 0 };
+
+    /**
+     * @brief      The name of the channel.
+     */
+    const char* m_strName { "default" };
+};
+
+
+/**
+ * @enum       EAssertAction
+ * @brief      The available actions for the failed \ref ASSERT_DEBUG.
+ */
+enum class EAssertAction
+{
+    /**
+     * @brief   Calls Terminate in \ref dbgh::CHandlerExecutor.
+     */
+    Abort,
+
+    /**
+     * @brief   Breaks into the debugger.
+     */
+    Debug,
+
+    /**
+     * @brief   Ignores this assertion and continues execution.
+     */
+    Ignore,
+
+    /**
+     * @brief   Ignores this assertion forever and continues execution.
+     */
+    IgnoreForever,
+
+    /**
+     * @brief   Throws \ref dbgh::CAssertException exception.
+     */
+    Throw
+}; // enum EAssertAction
+
+
+/**
+ * @enum       ECircuitAction
+ * @brief      The actions of the circuit breaker for the site which fails too often.
+ */
+enum class ECircuitAction
+{
+    /**
+     * @brief   Reports the failure as a failed \ref ASSERT_FATAL.
+     */
+    Escalate,
+
+    /**
+     * @brief   Reports one alert, then skips the failures of the site until the cool-down is elapsed.
+     */
+    Mute
+}; // enum ECircuitAction
+
+
 /**
  * @class      CAssertConfig
  * @brief      This singleton class describes an assert configuration.
@@ -85,8 +189,66 @@ public:
      *
      * @return     The reference to the object.
      */
-    static CAssertConfig& Get();
+    [[gnu::no_instrument_function]] static CAssertConfig& Get();
+
+
+    /**
+     * @brief      Sets the enabled levels of the channel.
+     *
+     * @details    The level is active in the channel if it is enabled by \ref EnableAsserts (the global levels) and
+     *              is in the mask of the channel, so the global levels do not overwrite the levels of the channels.
+     *              By default, the mask of a channel has all levels. The default channel is the channel of the asserts
+     *              without the _CH suffix.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage
+     *                     , dbgh::LevelMask(dbgh::EAssertLevel::Error, dbgh::EAssertLevel::Fatal));
+     *
+     * @param[in]  channel  The channel.
+     * @param[in]  levels   The mask of the enabled levels, see \ref dbgh::LevelMask.
+     */
+    [[maybe_unused]] void SetChannelLevels(SChannel channel, TLevelMask levels) noexcept;
 
+    /**
+     * @brief      Sets the enabled levels of the channel found by its name, for example read from a configuration.
+     *
+     * @details    Only the channels declared by \ref DBGH_CHANNEL in the linked code are known by name.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetChannelLevels("network", dbgh::LevelMask());
+     *
+     * @param[in]  name    The name of the channel, "default" for the default channel.
+     * @param[in]  levels  The mask of the enabled levels.
+     *
+     * @return     True if the channel is found, False otherwise.
+     */
+    [[maybe_unused]] bool SetChannelLevels(std::string_view name, TLevelMask levels) noexcept;
+
+    /**
+     * @brief      Gets the enabled levels of the channel.
+     *
+     * @param[in]  channel  The channel.
+     *
+     * @return     The mask of the enabled levels.
+     */
+    [[nodiscard]] TLevelMask GetChannelLevels(SChannel channel) const noexcept;
+
+    /**
+     * @internal
+     * @brief      Remembers the name of the declared channel, called by \ref DBGH_CHANNEL.
+     *
+     * @return     True if the index is free or has the same name, False if it is used by another channel,
+     *              the name of the first channel is kept.
+     */
+    bool RegisterChannel(SChannel channel) noexcept;
+
+    /**
+     * @internal
+     * @brief      Registers the channel declared by \ref DBGH_CHANNEL, aborts the program if the index is used
+     *              by another channel. The names of both channels are written into the fatal descriptor
+     *              (\ref SetFatalDescriptor), standard error by default.
+     *
+     * @return     True, the value is kept by the declaration.
+     */
+    bool DeclareChannel(SChannel channel) noexcept;
 
     /**
      * @brief      Enables the assert a given type.
@@ -113,9 +275,264 @@ public:
      *
      * @param[in]  level  The level
      *
+     * @details    The level is active if it is enabled and is not suppressed on the calling thread by
+     *              \ref dbgh::CScopedSuppress.
+     *
      * @return     True if the asserts of a given type are active, False otherwise.
      */
-    [[nodiscard]] bool IsActiveAssert(EAssertLevel level) const noexcept;
+    [[nodiscard, gnu::no_instrument_function]] bool IsActiveAssert(const EAssertLevel level) const noexcept
+    {
+        return IsActiveAssert(SChannel { }, level);
+    }
+
+    /**
+     * @internal
+     * @brief      Determines whether the specified level is active in the channel.
+     *
+     * @details    The same as the other overload, but the enabled levels are taken from the channel.
+     *
+     * @param[in]  channel  The channel.
+     * @param[in]  level    The level
+     *
+     * @return     True if the asserts of a given type are active in the channel, False otherwise.
+     */
+    [[nodiscard, gnu::no_instrument_function]] bool IsActiveAssert(
+            const SChannel channel, const EAssertLevel level) const noexcept
+    {
+        // The pass path of every assert, inlined: the loads of the global and the channel masks and one thread-local load.
+        return 0 != (m_uLevels.load(std::memory_order_relaxed) & m_arrChannelLevels[channel.m_uIndex].load(std::memory_order_relaxed)
+                     & ~s_uSuppressedLevels & LevelMask(level));
+    }
+
+    /**
+     * @internal
+     * @brief      Determines whether the specified level is enabled, ignoring the suppression of the calling thread.
+     *
+     * @param[in]  level  The level
+     *
+     * @return     True if the asserts of a given type are enabled, False otherwise.
+     */
+    [[nodiscard]] bool IsEnabledAssert(EAssertLevel level) const noexcept;
+
+    /**
+     * @brief      Sets the sampling rate for the sampled asserts of a given type.
+     *
+     * @details    The sampled asserts (\ref ASSERT_AUDIT) evaluate the expression only on 1-in-N executions
+     *              per site and per thread. The rate of the level is used for all sites which do not have
+     *              their own rate.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetSamplingRate(dbgh::EAssertLevel::Audit, 1000);
+     *
+     * @param[in]  level  The type of assert. Types defined in enum \ref dbgh::EAssertLevel.
+     * @param[in]  rate   The N, the expression is evaluated once per N executions. 0 and 1 mean every execution.
+     */
+    [[maybe_unused]] void SetSamplingRate(EAssertLevel level, std::uint32_t rate) noexcept;
+
+    /**
+     * @brief      Sets the sampling rate for the sampled asserts placed in the given file and line.
+     *
+     * @details    The site is found by the tail of the file path, so the file name is enough. The line zero
+     *              matches all sampled asserts in the file. Only sites which were executed at least once are
+     *              known to the library. The rate zero resets the site to the level rate.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetSamplingRate("CTree.cpp", 142, 10);
+     *
+     * @param[in]  file  The file name or the tail of the file path.
+     * @param[in]  line  The line number, or zero for all lines.
+     * @param[in]  rate  The N, the expression is evaluated once per N executions.
+     *
+     * @return     The count of the updated sites.
+     */
+    [[maybe_unused]] std::size_t SetSamplingRate(std::string_view file, TLine line, std::uint32_t rate) noexcept;
+
+    /**
+     * @internal
+     * @brief      Gets the sampling rate for the sampled asserts of a given type.
+     *
+     * @param[in]  level  The level
+     *
+     * @return     The sampling rate.
+     */
+    [[nodiscard]] std::uint32_t GetSamplingRate(EAssertLevel level) const noexcept;
+
+    /**
+     * @brief      Limits the CPU time spent on the evaluation of the sampled asserts.
+     *
+     * @details    The governor measures the evaluation cost of every sampled assert (\ref ASSERT_AUDIT) site and,
+     *              at the end of each window, raises or lowers the sampling rates of the expensive sites so that all
+     *              evaluations take at most the given fraction of the CPU time consumed by the process. The cheap
+     *              sites (below one microsecond per evaluation) keep their configured rates, the governor never
+     *              samples a site less often than its configured rate.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetCpuBudget(0.01);
+     *
+     * @param[in]  fraction  The fraction of the CPU time, zero disables the governor. By default, zero.
+     * @param[in]  window    The length of the window between the rebalancings.
+     */
+    [[maybe_unused]] void SetCpuBudget(
+            double fraction, std::chrono::milliseconds window = std::chrono::milliseconds { 100 }) noexcept;
+
+    /**
+     * @brief      Gets the CPU budget of the sampled asserts.
+     *
+     * @return     The fraction of the CPU time, zero if the governor is disabled.
+     */
+    [[nodiscard]] double GetCpuBudget() const noexcept;
+
+    /**
+     * @brief      Sets the circuit breaker for the asserts of a given type.
+     *
+     * @details    Every site counts its failures in the one second window which starts at the first failure.
+     *              When the count exceeds the threshold, the breaker trips: with \ref ECircuitAction::Escalate the
+     *              failure is reported as a failed \ref ASSERT_FATAL, with \ref ECircuitAction::Mute one alert is
+     *              reported as a warning and the failures of the site are skipped until the cool-down is elapsed.
+     *              The count of the skipped failures is reported by the first failure of the site after the
+     *              cool-down, not when the cool-down elapses: the breaker has no timer and the passed assertions
+     *              do not touch it, so the count is never reported if the site does not fail again.
+     *              The state is per site and lock-free, it is touched only by the failed assertions.
+     *              Applies to all asserts except \ref ASSERT_FATAL_SAFE, including the sampled, rate limited,
+     *              periodic and deferred asserts, for the rate limited ones only the failures allowed by the limiter
+     *              are counted.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetCircuitBreaker(dbgh::EAssertLevel::Error, 1000);
+     *
+     * @param[in]  level      The type of assert. Types defined in enum \ref dbgh::EAssertLevel.
+     * @param[in]  threshold  The count of failures per second, zero disables the breaker. By default, zero.
+     * @param[in]  action     The action of the tripped breaker.
+     * @param[in]  cooldown   The time while the muted site is skipped.
+     */
+    [[maybe_unused]] void SetCircuitBreaker(
+            EAssertLevel level, std::uint32_t threshold, ECircuitAction action = ECircuitAction::Mute
+            , std::chrono::milliseconds cooldown = std::chrono::seconds { 10 }) noexcept;
+
+    /**
+     * @brief      Sets the count of threads which take part in the parallel checks (\ref ASSERT_ALL_OF_PAR).
+     *
+     * @details    The calling thread is counted, so the pool has count - 1 workers. The workers are created on
+     *              the first parallel check and recreated on the next check after the count is changed.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetParallelCheckThreads(8);
+     *
+     * @param[in]  count  The count of threads, zero means std::thread::hardware_concurrency.
+     */
+    [[maybe_unused]] void SetParallelCheckThreads(std::size_t count) noexcept;
+
+    /**
+     * @internal
+     * @brief      Gets the count of threads which take part in the parallel checks.
+     *
+     * @return     The count of threads, or zero if the hardware concurrency is used.
+     */
+    [[nodiscard]] std::size_t GetParallelCheckThreads() const noexcept;
+
+    /**
+     * @brief      Sets the action for the failed \ref ASSERT_DEBUG when the user cannot be asked.
+     *
+     * @details    The headless action is used if the executor is not interactive (by default, if the standard
+     *              input is not a terminal), if the prompt timeout is expired, or if another thread is already
+     *              prompting the user. By default, the assertion is ignored.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetHeadlessAction(dbgh::EAssertAction::Throw);
+     *
+     * @param[in]  action  The action.
+     */
+    [[maybe_unused]] void SetHeadlessAction(EAssertAction action) noexcept;
+
+    /**
+     * @brief      Gets the action for the failed \ref ASSERT_DEBUG when the user cannot be asked.
+     *
+     * @return     The headless action.
+     */
+    [[nodiscard]] EAssertAction GetHeadlessAction() const noexcept;
+
+    /**
+     * @brief      Sets the maximal time of waiting for the user decision in \ref ASSERT_DEBUG.
+     *
+     * @details    After the timeout, the headless action is applied. By default, zero, waits without limit.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetPromptTimeout(std::chrono::seconds { 30 });
+     *
+     * @param[in]  timeout  The timeout, zero means without limit.
+     */
+    [[maybe_unused]] void SetPromptTimeout(std::chrono::milliseconds timeout) noexcept;
+
+    /**
+     * @brief      Gets the maximal time of waiting for the user decision in \ref ASSERT_DEBUG.
+     *
+     * @return     The timeout, zero means without limit.
+     */
+    [[nodiscard]] std::chrono::milliseconds GetPromptTimeout() const noexcept;
+
+    /**
+     * @brief      Sets the file descriptor for the allocation-free fatal path.
+     *
+     * @details    If the descriptor is set, the failed \ref ASSERT_FATAL does not call the executor: the assertion
+     *              information is written by raw write(2) from a preallocated static buffer, then std::abort is
+     *              called. Only \ref ASSERT_FATAL_SAFE is async-signal-safe and usable after the heap corruption,
+     *              ASSERT_FATAL formats its message on the heap before the report is written.
+     *              By default, -1, ASSERT_FATAL uses Terminate of the executor and \ref ASSERT_FATAL_SAFE writes
+     *              to the standard error.
+     *
+     * @example    dbgh::CAssertConfig::Get().SetFatalDescriptor(open("fatal.log", O_WRONLY | O_CREAT | O_APPEND, 0644));
+     *
+     * @param[in]  descriptor  The file descriptor, or -1.
+     */
+    [[maybe_unused]] void SetFatalDescriptor(int descriptor) noexcept;
+
+    /**
+     * @brief      Gets the file descriptor for the allocation-free fatal path.
+     *
+     * @return     The file descriptor, or -1 if it is not set.
+     */
+    [[nodiscard]] static int GetFatalDescriptor() noexcept;
+
+    /**
+     * @brief      Installs the handlers of the crash signals which dump the assertion state before the process dies.
+     *
+     * @details    When the process receives SIGSEGV, SIGBUS, SIGABRT, SIGFPE or SIGILL, the handler writes the signal,
+     *              the enabled levels, the last assertion failures, the \ref DBGH_CONTEXT stack and the raw return
+     *              addresses of the crashed thread to the file descriptor, then restores the previous handler and
+     *              raises the signal again. Nothing is allocated or locked on that path.
+     *              The handlers run on the alternate signal stack of the calling thread, the other threads
+     *              get it by \ref InstallCrashHandlersForThread. On a thread without the alternate stack
+     *              the stack overflow is not dumped. Not supported on Windows.
+     *
+     * @example    dbgh::CAssertConfig::Get().InstallCrashHandlers();
+     *
+     * @param[in]  descriptor  The file descriptor for the dump, -1 means the fatal descriptor or the standard error.
+     *
+     * @return     True if the handlers are installed, False otherwise.
+     */
+    [[maybe_unused]] bool InstallCrashHandlers(int descriptor = -1) noexcept;
+
+    /**
+     * @brief      Gives the calling thread the alternate signal stack of the crash handlers, so its stack overflow
+     *              is dumped too. Called at the start of the threads, the stack is freed at the thread exit.
+     *
+     * @example    std::thread worker { [] { dbgh::CAssertConfig::Get().InstallCrashHandlersForThread(); Work(); } };
+     *
+     * @return     True if the thread has the alternate stack, False otherwise.
+     */
+    [[maybe_unused]] static bool InstallCrashHandlersForThread() noexcept;
+
+    /**
+     * @brief      Publishes the failure counters per level and per site into the shared-memory segment.
+     *
+     * @details    The segment /dev/shm/dbgh.<pid> is created and mapped, after that every failed assertion
+     *              increments the counters by atomic operations. The dbgh_top viewer maps the segment read-only
+     *              and shows the top failing sites, the readers add no overhead to the process.
+     *              The segment is removed at exit. Not supported on Windows.
+     *
+     * @example    dbgh::CAssertConfig::Get().EnableSharedStatistics();
+     *
+     * @return     True if the segment is published, False otherwise.
+     */
+    [[maybe_unused]] bool EnableSharedStatistics() noexcept;
+
+    /**
+     * @brief      Stops the publishing of the failure counters and removes the shared-memory segment.
+     */
+    [[maybe_unused]] void DisableSharedStatistics() noexcept;
 
     /**
      * @brief      Sets the new executor.
@@ -135,6 +552,7 @@ public:
      *
      * @throw      std::invalid_argument exception if the new executor is null.
      *              The exception message is "Executor cannot be null."
+     *              Without the exceptions the null executor is reported as a failed fatal assertion and aborts.
      *
      * @param[in]  executor  The unique pointer to the new executor.
      */
@@ -150,11 +568,62 @@ public:
 
 private:
 
+    friend class CScopedSuppress;
+
+    /**
+     * @internal
+     * @brief      The mask of the levels suppressed on this thread, see \ref dbgh::CScopedSuppress.
+     */
+    static constinit inline thread_local TLevelMask s_uSuppressedLevels { 0 };
+
+    /**
+     * @internal
+     * @brief      The mask of the globally enabled assert levels, changed by \ref EnableAsserts and \ref DisableAsserts.
+     */
+    std::atomic<TLevelMask> m_uLevels;
+
+    /**
+     * @internal
+     * @brief      The masks of the enabled assert levels of each channel.
+     */
+    std::array<std::atomic<TLevelMask>, SChannel::s_uMaxCount> m_arrChannelLevels;
+
+    /**
+     * @internal
+     * @brief      The names of the declared channels, null if the channel is not declared.
+     */
+    std::array<std::atomic<const char*>, SChannel::s_uMaxCount> m_arrChannelNames;
+
+    /**
+     * @internal
+     * @brief      An array that stores the sampling rate of the sampled asserts for each level.
+     */
+    std::array<std::atomic<std::uint32_t>, static_cast<size_t>(EAssertLevel::END_ENUM_)> m_arrSamplingRates;
+
+    /**
+     * @internal
+     * @brief      The count of threads for the parallel checks, zero means the hardware concurrency.
+     */
+    std::atomic<std::size_t> m_uParallelCheckThreads;
+
+    /**
+     * @internal
+     * @brief      The action for the failed debug assert when the user cannot be asked.
+     */
+    std::atomic<EAssertAction> m_eHeadlessAction;
+
+    /**
+     * @internal
+     * @brief      The timeout of the prompt in milliseconds, zero means without limit.
+     */
+    std::atomic<std::chrono::milliseconds::rep> m_iPromptTimeout;
+
     /**
      * @internal
-     * @brief      An array that stores the state of the assertion (enabled(true) or disabled(false)).
+     * @brief      The file descriptor for the allocation-free fatal path, -1 if it is not set. It is static, so
+     *              the fatal path reads it without the instance.
      */
-    std::array<bool, static_cast<size_t>(EAssertLevel::END_ENUM_)> m_arrEnableFlags;
+    static constinit inline std::atomic<int> s_iFatalDescriptor { -1 };
 
     /**
      * @internal
@@ -0,0 +1,95 @@
+/**
+ * @file        CAssertContext.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CAssertContext class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <algorithm>
+
+#include "CAssertContext.h"
+#include "CSafeWriter.h"
+
+namespace dbgh
+{
+
+void CAssertContext::Render(std::ostream& stream, const char* prefix)
+{
+    const auto& stack = s_stack;
+    const auto storedDepth = std::min(stack.m_uDepth, s_uMaxDepth);
+    for (std::size_t i = 0; i < storedDepth; ++i)
+    {
+        const auto& entry = stack.m_arrEntries[i];
+        stream << prefix << (nullptr != entry.m_strKey ? entry.m_strKey : "(null)") << " = ";
+        switch (entry.m_eKind)
+        {
+            case EValueKind::Signed:
+                stream << entry.m_iSigned;
+                break;
+            case EValueKind::Unsigned:
+                stream << entry.m_uUnsigned;
+                break;
+            case EValueKind::Floating:
+                stream << entry.m_dFloating;
+                break;
+            case EValueKind::Boolean:
+                stream << (entry.m_bBoolean ? "true" : "false");
+                break;
+            case EValueKind::String:
+                stream << (nullptr != entry.m_strString ? entry.m_strString : "(null)");
+                break;
+            case EValueKind::Pointer:
+                stream << entry.m_pPointer;
+                break;
+            default:
+                break;
+        }
+        stream << std::endl;
+    }
+    if (stack.m_uDepth > storedDepth)
+    {
+        stream << prefix << "... " << (stack.m_uDepth - storedDepth) << " more scopes" << std::endl;
+    }
+}
+
+void CAssertContext::Render(impl::CSafeWriter& writer, const char* prefix) noexcept
+{
+    const auto& stack = s_stack;
+    const auto storedDepth = std::min(stack.m_uDepth, s_uMaxDepth);
+    for (std::size_t i = 0; i < storedDepth; ++i)
+    {
+        const auto& entry = stack.m_arrEntries[i];
+        writer.Write(prefix).Write(entry.m_strKey).Write(" = ");
+        switch (entry.m_eKind)
+        {
+            case EValueKind::Signed:
+                writer.WriteSigned(entry.m_iSigned);
+                break;
+            case EValueKind::Unsigned:
+                writer.WriteUnsigned(entry.m_uUnsigned);
+                break;
+            case EValueKind::Floating:
+                writer.WriteFloating(entry.m_dFloating);
+                break;
+            case EValueKind::Boolean:
+                writer.Write(entry.m_bBoolean ? "true" : "false");
+                break;
+            case EValueKind::String:
+                writer.Write(entry.m_strString);
+                break;
+            case EValueKind::Pointer:
+                writer.WriteHex(reinterpret_cast<std::uintptr_t>(entry.m_pPointer));
+                break;
+            default:
+                break;
+        }
+        writer.Write("\n");
+    }
+    if (stack.m_uDepth > storedDepth)
+    {
+        writer.Write(prefix).Write("... ").WriteUnsigned(stack.m_uDepth - storedDepth).Write(" more scopes\n");
+    }
+}
+
+} // namespace dbgh
@@ -0,0 +1,192 @@
+/**
+ * @file        CAssertContext.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CAssertContext class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+namespace dbgh
+{
+
+namespace impl
+{
+class CSafeWriter;
+} // namespace impl
+
+/**
+ * @class      CAssertContext
+ * @brief      The RAII scope which attaches a key and a value to the assertion reports of the current thread.
+ *
+ * @details    The scope pushes the key pointer and the raw value onto a fixed-size thread-local stack, nothing is
+ *              allocated or formatted. The stack is rendered into the assertion information only on failure.
+ *              The key and the string values are stored as pointers, they must outlive the scope.
+ *              The scopes deeper than \ref s_uMaxDepth are counted but not stored.
+ *
+ * @example    DBGH_CONTEXT("shard", shardId);
+ *             DBGH_CONTEXT("request", request.Id());
+ */
+class CAssertContext
+{
+public:
+
+    /**
+     * @brief      The maximal count of stored scopes per thread.
+     */
+    static constexpr std::size_t s_uMaxDepth = 32;
+
+    /**
+     * @brief      Pushes the key and the value onto the context stack of the current thread.
+     *
+     * @param[in]  key    The key, usually a string literal.
+     * @param[in]  value  The integer, floating point, bool, enum, string or pointer value.
+     */
+    template <typename TValue>
+    CAssertContext(const char* key, const TValue value) noexcept
+    {
+        auto& stack = s_stack;
+        if (stack.m_uDepth < s_uMaxDepth)
+        {
+            auto& entry = stack.m_arrEntries[stack.m_uDepth];
+            entry.m_strKey = key;
+            store(entry, value);
+        }
+        ++stack.m_uDepth;
+    }
+
+    ~CAssertContext()
+    {
+        --s_stack.m_uDepth;
+    }
+
+    CAssertContext(CAssertContext&&) noexcept = delete;
+
+    CAssertContext(const CAssertContext&) = delete;
+
+    CAssertContext& operator=(CAssertContext&&) noexcept = delete;
+
+    CAssertContext& operator=(const CAssertContext&) = delete;
+
+    /**
+     * @internal
+     * @brief      Writes the context stack of the current thread, one line per scope from the outermost.
+     *
+     * @param[in]  stream  The output stream.
+     * @param[in]  prefix  The prefix of each line.
+     */
+    static void Render(std::ostream& stream, const char* prefix);
+
+    /**
+     * @internal
+     * @brief      Writes the context stack of the current thread without allocations, usable in signal handlers.
+     *
+     * @param[in]  writer  The async-signal-safe writer.
+     * @param[in]  prefix  The prefix of each line.
+     */
+    static void Render(impl::CSafeWriter& writer, const char* prefix) noexcept;
+
+private:
+
+    /**
+     * @internal
+     * @enum       EValueKind
+     * @brief      The type of the stored value.
+     */
+    enum class EValueKind : std::uint8_t
+    {
+        Signed,
+        Unsigned,
+        Floating,
+        Boolean,
+        String,
+        Pointer
+    };
+
+    /**
+     * @internal
+     * @brief      One stored scope.
+     */
+    struct SEntry
+    {
+        const char* m_strKey;
+        EValueKind m_eKind;
+        union
+        {
+            std::int64_t m_iSigned;
+            std::uint64_t m_uUnsigned;
+            double m_dFloating;
+            bool m_bBoolean;
+            const char* m_strString;
+            const void* m_pPointer;
+        };
+    };
+
+    /**
+     * @internal
+     * @brief      The context stack of one thread.
+     */
+    struct SStack
+    {
+        SEntry m_arrEntries[s_uMaxDepth];
+        std::size_t m_uDepth;
+    };
+
+    /**
+     * @internal
+     * @brief      Stores the value into the entry.
+     */
+    template <typename TValue>
+    static void store(SEntry& entry, const TValue value) noexcept
+    {
+        if constexpr (std::is_same_v<TValue, bool>)
+        {
+            entry.m_eKind = EValueKind::Boolean;
+            entry.m_bBoolean = value;
+        }
+        else if constexpr (std::is_enum_v<TValue>)
+        {
+            store(entry, static_cast<std::underlying_type_t<TValue>>(value));
+        }
+        else if constexpr (std::is_integral_v<TValue> && std::is_signed_v<TValue>)
+        {
+            entry.m_eKind = EValueKind::Signed;
+            entry.m_iSigned = value;
+        }
+        else if constexpr (std::is_integral_v<TValue>)
+        {
+            entry.m_eKind = EValueKind::Unsigned;
+            entry.m_uUnsigned = value;
+        }
+        else if constexpr (std::is_floating_point_v<TValue>)
+        {
+            entry.m_eKind = EValueKind::Floating;
+            entry.m_dFloating = static_cast<double>(value);
+        }
+        else if constexpr (std::is_same_v<TValue, const char*> || std::is_same_v<TValue, char*>)
+        {
+            entry.m_eKind = EValueKind::String;
+            entry.m_strString = value;
+        }
+        else
+        {
+            static_assert(std::is_pointer_v<TValue>, "DBGH_CONTEXT supports only arithmetic, enum, string and pointer values.");
+            entry.m_eKind = EValueKind::Pointer;
+            entry.m_pPointer = value;
+        }
+    }
+
+    /**
+     * @internal
+     * @brief      The context stack of the current thread.
+     */
+    static constinit inline thread_local SStack s_stack { };
+};
+
+} // namespace dbgh
@@ -7,6 +7,7 @@
  */
 
 #include "CAssertException.h"
+#include "CExpressionText.h"
 
 
 namespace dbgh
@@ -23,7 +24,7 @@ CAssertException::CAssertException(
         : std::exception (),
         m_strMessage(std::move(message)),
         m_strFileName(file),
-        m_strExpression(expression),
+        m_strExpression(impl::CExpressionText::Decode(expression)),
         m_strFunction(function),
         m_iLineNumber(line)
 { }
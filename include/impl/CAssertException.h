@@ -12,6 +12,29 @@
 #include <string_view>
 
 
+/**
+ * @brief      Defined if the code is compiled with the exceptions. Without the exceptions (for example -fno-exceptions)
+ *              the failed ASSERT_ERROR is handled by \ref dbgh::CHandlerExecutor::HandleError without throwing.
+ */
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define DBGH_ASSERTS_EXCEPTIONS
+#endif
+
+
+/**
+ * @internal
+ * @brief      The try and catch blocks of the library which are compiled out without the exceptions.
+ *              The catch block must not use the exception object.
+ */
+#ifdef DBGH_ASSERTS_EXCEPTIONS
+#define IMPL_DBGH_TRY           try
+#define IMPL_DBGH_CATCH(...)    catch (__VA_ARGS__)
+#else
+#define IMPL_DBGH_TRY           if constexpr (true)
+#define IMPL_DBGH_CATCH(...)    else
+#endif
+
+
 namespace dbgh
 {
 /**
@@ -0,0 +1,195 @@
+/**
+ * @file        CAssertGovernor.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CAssertGovernor class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <algorithm>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+#include "CAssertException.h"
+#include "CAssertGovernor.h"
+
+namespace dbgh::impl
+{
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      The mutex of the rebalancing, the threads which do not get it skip the rebalancing.
+ */
+std::mutex s_mtxRebalance;
+
+/**
+ * @internal
+ * @brief      The length of the window in ticks.
+ */
+constinit std::atomic<std::uint64_t> s_uWindowTicks { 0 };
+
+/**
+ * @internal
+ * @brief      The process CPU time at the start of the current window, guarded by s_mtxRebalance.
+ */
+std::clock_t s_clkWindowStart { 0 };
+
+/**
+ * @internal
+ * @brief      The load of one site in the finished window.
+ */
+struct SSiteLoad
+{
+    SAssertSite* m_pSite;
+
+    /**
+     * @brief      The estimated cost of the window if every execution of the site were evaluated.
+     */
+    std::uint64_t m_uFullCostNs;
+};
+
+/**
+ * @internal
+ * @brief      Gets the rate which is used for the site if the governor does not throttle it.
+ */
+[[nodiscard]] std::uint32_t ConfiguredRate(const SAssertSite& site) noexcept
+{
+    const auto rate = site.m_uSamplingRate.load(std::memory_order_relaxed);
+    return std::max<std::uint32_t>(1, 0 != rate ? rate : CAssertConfig::Get().GetSamplingRate(site.m_eLevel));
+}
+
+/**
+ * @internal
+ * @brief      Halves the governed rate of the site which is not evaluated in the window, the rate which falls to
+ *              the configured rate releases the site.
+ */
+void RelaxIdleSite(SAssertSite& site) noexcept
+{
+    const auto governedRate = site.m_uGovernedRate.load(std::memory_order_relaxed);
+    if (0 == governedRate)
+    {
+        return;
+    }
+    const auto rate = governedRate / 2;
+    site.m_uGovernedRate.store(rate > ConfiguredRate(site) ? rate : 0, std::memory_order_relaxed);
+}
+
+void ReleaseAllSites() noexcept
+{
+    CSiteRegistry::ForEach({ }, 0, [](SAssertSite& site) noexcept
+    {
+        site.m_uGovernedRate.store(0, std::memory_order_relaxed);
+        site.m_uEvaluations.store(0, std::memory_order_relaxed);
+        site.m_uTicks.store(0, std::memory_order_relaxed);
+        site.m_uExecutions.store(0, std::memory_order_relaxed);
+    });
+}
+
+}  // unnamed namespace
+
+void CAssertGovernor::SetBudget(const double fraction, const std::chrono::milliseconds window) noexcept
+{
+    const std::lock_guard lock { s_mtxRebalance };
+    if (! (fraction > 0.0))
+    {
+        s_uBudgetPpm.store(0, std::memory_order_relaxed);
+        ReleaseAllSites();
+        return;
+    }
+
+    // Converts the window to ticks, the first conversion calibrates the counter here and not on the assertion path.
+    constexpr std::uint64_t uCalibrationTicks = 1'000'000'000;
+    const auto calibrationNs = std::max<std::uint64_t>(1, CTsc::ToNanoseconds(uCalibrationTicks));
+    const auto windowNs = static_cast<std::uint64_t>(
+            std::max<std::chrono::nanoseconds::rep>(1, std::chrono::nanoseconds { window }.count()));
+    const auto windowTicks = static_cast<std::uint64_t>(
+            static_cast<double>(windowNs) * static_cast<double>(uCalibrationTicks) / static_cast<double>(calibrationNs));
+    s_uWindowTicks.store(windowTicks, std::memory_order_relaxed);
+
+    s_clkWindowStart = std::clock();
+    s_uWindowEnd.store(CTsc::Now() + windowTicks, std::memory_order_relaxed);
+    s_uBudgetPpm.store(static_cast<std::uint32_t>(std::clamp(fraction, 1e-6, 1.0) * 1e6), std::memory_order_relaxed);
+}
+
+double CAssertGovernor::GetBudget() noexcept
+{
+    return static_cast<double>(s_uBudgetPpm.load(std::memory_order_relaxed)) / 1e6;
+}
+
+void CAssertGovernor::rebalance(const std::uint64_t now) noexcept
+{
+    const std::unique_lock lock { s_mtxRebalance, std::try_to_lock };
+    if (! lock.owns_lock() || now < s_uWindowEnd.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    const auto budgetPpm = s_uBudgetPpm.load(std::memory_order_relaxed);
+    if (0 == budgetPpm)
+    {
+        return;
+    }
+    s_uWindowEnd.store(now + s_uWindowTicks.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    const auto clkNow = std::clock();
+    const auto cpuNs = static_cast<std::uint64_t>(std::max<double>(
+            0.0, static_cast<double>(clkNow - s_clkWindowStart) * 1e9 / static_cast<double>(CLOCKS_PER_SEC)));
+    s_clkWindowStart = clkNow;
+    auto remainingNs = cpuNs * budgetPpm / 1'000'000;
+
+    IMPL_DBGH_TRY
+    {
+        // The cheap sites are never throttled, their cost is taken from the budget first.
+        std::vector<SSiteLoad> expensiveSites;
+        CSiteRegistry::ForEach({ }, 0, [&expensiveSites, &remainingNs](SAssertSite& site)
+        {
+            const auto evaluations = site.m_uEvaluations.exchange(0, std::memory_order_relaxed);
+            const auto costNs = CTsc::ToNanoseconds(site.m_uTicks.exchange(0, std::memory_order_relaxed));
+            const auto executions = site.m_uExecutions.exchange(0, std::memory_order_relaxed);
+            if (0 == evaluations)
+            {
+                RelaxIdleSite(site);
+                return;
+            }
+            const auto fullCostNs = static_cast<std::uint64_t>(
+                    static_cast<double>(costNs) * static_cast<double>(executions) / static_cast<double>(evaluations));
+            if (costNs / evaluations < s_uCheapCostNs)
+            {
+                site.m_uGovernedRate.store(0, std::memory_order_relaxed);
+                remainingNs -= std::min(remainingNs, fullCostNs / ConfiguredRate(site));
+                return;
+            }
+            expensiveSites.push_back({ &site, fullCostNs });
+        });
+
+        // Shares the rest equally, the unused share of the cheaper sites goes to the more expensive ones.
+        std::sort(std::begin(expensiveSites), std::end(expensiveSites), [](const SSiteLoad& lhs, const SSiteLoad& rhs)
+        {
+            return lhs.m_uFullCostNs < rhs.m_uFullCostNs;
+        });
+        for (std::size_t i = 0; i < expensiveSites.size(); ++i)
+        {
+            auto& site = *expensiveSites[i].m_pSite;
+            const auto fullCostNs = expensiveSites[i].m_uFullCostNs;
+            const auto shareNs = remainingNs / (expensiveSites.size() - i);
+            const auto configuredRate = ConfiguredRate(site);
+            auto rate = configuredRate;
+            if (fullCostNs / configuredRate > shareNs)
+            {
+                rate = 0 == shareNs
+                       ? s_uMaxRate
+                       : static_cast<std::uint32_t>(std::min<std::uint64_t>(s_uMaxRate, (fullCostNs + shareNs - 1) / shareNs));
+            }
+            site.m_uGovernedRate.store(rate > configuredRate ? rate : 0, std::memory_order_relaxed);
+            remainingNs -= std::min(remainingNs, fullCostNs / rate);
+        }
+    }
+    IMPL_DBGH_CATCH(...)
+    {
+    }
+}
+
+} // namespace dbgh::impl
@@ -0,0 +1,129 @@
+/**
+ * @file        CAssertGovernor.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CAssertGovernor class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "CAssertSite.h"
+#include "CTsc.h"
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CAssertGovernor
+ * @brief      Keeps the evaluation cost of the sampled asserts within the CPU budget.
+ *
+ * @details    While the budget is set, every evaluation of a sampled assert is timed by the time stamp counter
+ *              and accumulated in its site. At the end of each window the thread which evaluates an assertion
+ *              rebalances the sites: the budget is the given fraction of the CPU time consumed by the process in the
+ *              window, the cheap sites (the mean evaluation cost below \ref s_uCheapCostNs) keep their configured
+ *              rate, the rest of the budget is shared equally by the expensive sites. The site whose full cost does
+ *              not fit its share is throttled, its rate is stored in \ref SAssertSite::m_uGovernedRate and
+ *              consulted by \ref CAssertSampler with one relaxed load. The unused share of a site is passed to
+ *              the next sites, so the governor lowers the rates again when the load falls. The full cost of a site is
+ *              its mean evaluation cost times the executions covered by its evaluations, the sum of the rates
+ *              with which they were sampled. The rate of a throttled site which is not evaluated in a window is
+ *              halved towards its configured rate, so the site is measured again.
+ */
+class CAssertGovernor
+{
+public:
+    CAssertGovernor() = delete;
+
+    ~CAssertGovernor() = delete;
+
+    CAssertGovernor(CAssertGovernor&&) noexcept = delete;
+
+    CAssertGovernor(const CAssertGovernor&) = delete;
+
+    CAssertGovernor& operator=(CAssertGovernor&&) = delete;
+
+    CAssertGovernor& operator=(const CAssertGovernor&) = delete;
+
+    /**
+     * @brief      The mean evaluation cost in nanoseconds below which the site is never throttled.
+     */
+    static constexpr std::uint64_t s_uCheapCostNs = 1000;
+
+    /**
+     * @brief      The maximal sampling rate chosen by the governor.
+     */
+    static constexpr std::uint32_t s_uMaxRate = 1U << 20U;
+
+    /**
+     * @brief      Sets the CPU budget of the sampled asserts.
+     *
+     * @param[in]  fraction  The fraction of the process CPU time, zero or less disables the governor.
+     * @param[in]  window    The length of the rebalancing window.
+     */
+    static void SetBudget(double fraction, std::chrono::milliseconds window) noexcept;
+
+    /**
+     * @brief      Gets the CPU budget of the sampled asserts.
+     *
+     * @return     The fraction of the process CPU time, zero if the governor is disabled.
+     */
+    [[nodiscard]] static double GetBudget() noexcept;
+
+    /**
+     * @brief      Evaluates the expression of the sampled assert and accounts its cost to the site.
+     *
+     * @param[in]  site        The site descriptor.
+     * @param[in]  countdown   The countdown set by \ref CAssertSampler::ShouldEvaluate for this evaluation, the
+     *                          evaluation covers countdown + 1 executions of the site.
+     * @param[in]  expression  The callable which evaluates the expression.
+     *
+     * @return     The result of the expression.
+     */
+    template <typename TExpression>
+    static bool Evaluate(SAssertSite& site, const std::uint32_t countdown, const TExpression& expression)
+    {
+        if (0 == s_uBudgetPpm.load(std::memory_order_relaxed))
+        {
+            return expression();
+        }
+        const auto start = CTsc::Now();
+        const bool bResult = expression();
+        const auto end = CTsc::Now();
+        site.m_uEvaluations.fetch_add(1, std::memory_order_relaxed);
+        site.m_uTicks.fetch_add(end - start, std::memory_order_relaxed);
+        site.m_uExecutions.fetch_add(std::uint64_t { countdown } + 1, std::memory_order_relaxed);
+        if (end >= s_uWindowEnd.load(std::memory_order_relaxed))
+        {
+            rebalance(end);
+        }
+        return bResult;
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      Recomputes the governed rates of all sites, only one thread does it per window.
+     */
+    static void rebalance(std::uint64_t now) noexcept;
+
+    /**
+     * @internal
+     * @brief      The budget in parts per million of the process CPU time, zero if the governor is disabled.
+     */
+    static constinit inline std::atomic<std::uint32_t> s_uBudgetPpm { 0 };
+
+    /**
+     * @internal
+     * @brief      The timestamp of the end of the current window.
+     */
+    static constinit inline std::atomic<std::uint64_t> s_uWindowEnd { 0 };
+};
+
+} // namespace dbgh::impl
@@ -6,11 +6,21 @@
  * @copyright   Copyright (c) 2020
  */
 
+#include <atomic>
+#include <cstdlib>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <cassert>
 
 #include "CAssertHandler.h"
+#include "CAssertContext.h"
+#include "CExpressionText.h"
+#include "CFailureLatency.h"
+#include "CFailureLog.h"
+#include "CProbes.h"
+#include "CSafeWriter.h"
+#include "CSharedStats.h"
 
 using namespace std::string_view_literals;
 
@@ -19,6 +29,25 @@ namespace dbgh::impl
 
 namespace
 {
+/**
+ * @internal
+ * @brief      The mutex of the console, the owner prompts the user for the action of the failed debug assert.
+ */
+std::mutex s_mtxConsole;
+
+/**
+ * @internal
+ * @brief      The preallocated buffer of the fatal path and its ownership flag.
+ */
+char s_arrFatalBuffer[CAssertHandler::s_uFatalBufferSize];
+constinit std::atomic_flag s_bFatalBufferBusy;
+
+/**
+ * @internal
+ * @brief      The standard error descriptor.
+ */
+constexpr int s_iStandardError = 2;
+
 [[nodiscard]] const char* ToString(const EAssertLevel level)
 {
     switch (level)
@@ -31,6 +60,8 @@ namespace
             return "DEBUG";
         case EAssertLevel::Fatal:
             return "FATAL";
+        case EAssertLevel::Audit:
+            return "AUDIT";
         case EAssertLevel::END_ENUM_:
             [[fallthrough]];
         default:
@@ -43,38 +74,59 @@ template<EAssertLevel T, std::enable_if_t<(EAssertLevel::Warning == T), int>>
 inline void CAssertHandler::HandleAssert(
         std::string message, const char* expression, const char* file, TLine line, const char* function)
 {
-    CAssertConfig::Get().GetExecutor()->HandleWarning(margeAssertInfo(T, message, expression, file, line, function));
+    recordFailure(T, message.c_str(), expression, file, line, function);
+    const auto strInfo = margeAssertInfo(T, message, expression, file, line, function);
+    const CLatencyScope latency { T, EFailurePhase::Executor };
+    CAssertConfig::Get().GetExecutor()->HandleWarning(strInfo);
 }
 
 template<EAssertLevel T, std::enable_if_t<(EAssertLevel::Debug == T), int>>
-inline void CAssertHandler::HandleAssert(
+inline bool CAssertHandler::HandleAssert(
         std::string message, const char* expression, const char* file, TLine line, const char* function, bool& ignore)
 {
     CAssertConfig::Get().GetExecutor()->DebugPreCall();
 
+    recordFailure(T, message.c_str(), expression, file, line, function);
     const auto strInfo = margeAssertInfo(T, message, expression, file, line, function);
 
-    CAssertConfig::Get().GetExecutor()->ShowMessage(strInfo);
+    // Only one thread owns the console, the other failing threads do not wait and use the headless action.
+    auto action = CAssertConfig::Get().GetHeadlessAction();
+    std::unique_lock consoleLock { s_mtxConsole, std::defer_lock };
+    if (CAssertConfig::Get().GetExecutor()->IsInteractive() && consoleLock.try_lock())
+    {
+        CAssertConfig::Get().GetExecutor()->ShowMessage(strInfo);
+        action = waitForUserDecision(CAssertConfig::Get().GetPromptTimeout());
+        consoleLock.unlock();
+    }
+    else
+    {
+        const CLatencyScope latency { T, EFailurePhase::Executor };
+        CAssertConfig::Get().GetExecutor()->Logs(strInfo);
+    }
 
-    const auto action = waitForUserDecision();
     switch (action)
     {
         case EAssertAction::Abort:
             CAssertConfig::Get().GetExecutor()->Terminate(strInfo);
-            break;
+            return false;
         case EAssertAction::Throw:
+#ifdef DBGH_ASSERTS_EXCEPTIONS
             throw CAssertException { message, expression, file, line, function };
-            break;
+#else
+            // Nothing can be thrown, the execution cannot continue after the assertion.
+            CAssertConfig::Get().GetExecutor()->Terminate(strInfo);
+            return false;
+#endif
         case EAssertAction::Debug:
-            startDebugging();
-            break;
+            return true;
         case EAssertAction::Ignore:
-            return;
+            return false;
         case EAssertAction::IgnoreForever:
             ignore = true;
-            break;
+            return false;
         default:
             assert(false);
+            return false;
     }
 }
 
@@ -82,35 +134,141 @@ template<EAssertLevel T, std::enable_if_t<(EAssertLevel::Error == T), int>>
 inline void CAssertHandler::HandleAssert(
         std::string message, const char* expression, const char* file, TLine line, const char* function)
 {
+    recordFailure(T, message.c_str(), expression, file, line, function);
     auto assertInfo = margeAssertInfo(T, message, expression, file, line, function);
+    const CLatencyScope latency { T, EFailurePhase::Executor };
     CAssertConfig::Get().GetExecutor()->HandleError(assertInfo
                                                     , CAssertException { std::move(message), expression, file, line, function });
 }
 
+bool CAssertHandler::HandleAssert(
+        const EAssertLevel level, std::string message, const char* expression, const char* file, const TLine line,
+        const char* function, bool& ignore)
+{
+    switch (level)
+    {
+        case EAssertLevel::Warning:
+            HandleAssert<EAssertLevel::Warning>(std::move(message), expression, file, line, function);
+            break;
+        case EAssertLevel::Debug:
+            return ! ignore
+                   && HandleAssert<EAssertLevel::Debug>(std::move(message), expression, file, line, function, ignore);
+        case EAssertLevel::Error:
+            HandleAssert<EAssertLevel::Error>(std::move(message), expression, file, line, function);
+            break;
+        case EAssertLevel::Fatal:
+            HandleAssert<EAssertLevel::Fatal>(std::move(message), expression, file, line, function);
+            break;
+        case EAssertLevel::Audit:
+            HandleAssert<EAssertLevel::Audit>(std::move(message), expression, file, line, function);
+            break;
+        case EAssertLevel::END_ENUM_:
+            [[fallthrough]];
+        default:
+            break;
+    }
+    return false;
+}
+
+void CAssertHandler::HandleVerify(
+        const std::string& message, const char* expression, const char* file, const TLine line, const char* function)
+{
+    recordFailure(EAssertLevel::Error, message.c_str(), expression, file, line, function);
+    const auto strInfo = margeAssertInfo(EAssertLevel::Error, message, expression, file, line, function);
+    const CLatencyScope latency { EAssertLevel::Error, EFailurePhase::Executor };
+    CAssertConfig::Get().GetExecutor()->HandleVerify(strInfo);
+}
+
 template<EAssertLevel T, std::enable_if_t<(EAssertLevel::Fatal == T), int>>
 inline void CAssertHandler::HandleAssert(
         std::string message, const char* expression, const char* file, TLine line, const char* function)
 {
+    if (0 <= CAssertConfig::GetFatalDescriptor())
+    {
+        HandleFatal(message.c_str(), expression, file, line, function);
+    }
+    recordFailure(T, message.c_str(), expression, file, line, function);
     CAssertConfig::Get().GetExecutor()->Terminate(margeAssertInfo(T, message, expression, file, line, function));
 }
 
+template<EAssertLevel T, std::enable_if_t<(EAssertLevel::Audit == T), int>>
+inline void CAssertHandler::HandleAssert(
+        std::string message, const char* expression, const char* file, TLine line, const char* function)
+{
+    recordFailure(T, message.c_str(), expression, file, line, function);
+    const auto strInfo = margeAssertInfo(T, message, expression, file, line, function);
+    const CLatencyScope latency { T, EFailurePhase::Executor };
+    CAssertConfig::Get().GetExecutor()->HandleWarning(strInfo);
+}
+
+void CAssertHandler::HandleFatal(
+        const char* message, const char* expression, const char* file, const TLine line,
+        const char* function) noexcept
+{
+    char arrExpression[256];
+    const auto* text = CExpressionText::IsCompressed(expression)
+                       ? CExpressionText::Decode(expression, arrExpression, sizeof(arrExpression))
+                       : expression;
+    recordFailure(EAssertLevel::Fatal, message, expression, file, line, function);
+
+    auto descriptor = CAssertConfig::GetFatalDescriptor();
+    if (descriptor < 0)
+    {
+        descriptor = s_iStandardError;
+    }
+
+    char arrFallbackBuffer[256];
+    const bool bOwner = ! s_bFatalBufferBusy.test_and_set(std::memory_order_acquire);
+    {
+        CSafeWriter writer { descriptor
+                             , bOwner ? s_arrFatalBuffer : arrFallbackBuffer
+                             , bOwner ? sizeof(s_arrFatalBuffer) : sizeof(arrFallbackBuffer) };
+        writer.Write(ToString(EAssertLevel::Fatal)).Write(" ASSERT:\n");
+        writer.Write("  [file]:         ").Write(file).Write("\n");
+        writer.Write("  [line]:         ").WriteSigned(line).Write("\n");
+        writer.Write("  [function]:     ").Write(function).Write("\n");
+        writer.Write("  [expression]:   ").Write(text).Write("\n");
+        writer.Write("  [what]:         ").Write(message).Write("\n");
+        CAssertContext::Render(writer, "  [context]:      ");
+        writer.Write("\n");
+    }
+    std::abort();
+}
+
+void CAssertHandler::recordFailure(
+        const EAssertLevel level, const char* message, const char* expression, const char* file, const TLine line,
+        const char* function) noexcept
+{
+    char arrExpression[256];
+    const auto* text = CExpressionText::IsCompressed(expression)
+                       ? CExpressionText::Decode(expression, arrExpression, sizeof(arrExpression))
+                       : expression;
+    CFailureLog::Record(level, message, expression, file, line, function);
+    CSharedStats::Record(level, text, file, line, function);
+    CProbes::Failed(level, file, line, message);
+}
+
 std::string CAssertHandler::margeAssertInfo(
         EAssertLevel level, const std::string& message, const char* expression, const char* file, TLine line,
         const char* function)
 {
+    const auto* text = CExpressionText::Decode(expression);
+    const CLatencyScope latency { level, EFailurePhase::Format };
+
     std::stringstream ss;
     ss << ToString(level) << " ASSERT:" << std::endl;
     ss << "  [uncaught exc]: " << std::uncaught_exceptions() << std::endl;
     ss << "  [file]:         " << file << std::endl;
     ss << "  [line]:         " << line << std::endl;
     ss << "  [function]:     " << function << std::endl;
-    ss << "  [expression]:   " << expression << std::endl;
+    ss << "  [expression]:   " << text << std::endl;
     ss << "  [what]:         " << message << std::endl;
+    CAssertContext::Render(ss, "  [context]:      ");
     ss << std::endl;
     return std::move(ss).str();
 }
 
-auto CAssertHandler::waitForUserDecision() -> EAssertAction
+auto CAssertHandler::waitForUserDecision(const std::chrono::milliseconds timeout) -> EAssertAction
 {
     const static std::map<char, EAssertAction> symbolToAction
             {
@@ -129,9 +287,25 @@ auto CAssertHandler::waitForUserDecision() -> EAssertAction
     CAssertConfig::Get().GetExecutor()->ShowMessage(
             "Press (I/i) - Ignore / (F/f) - Ignore forever / (D/d) - Debug / (T/t) - Throw exception / (B/b) - Abort \n"sv);
 
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
     for (;;)
     {
+        if (timeout.count() > 0)
+        {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now());
+            if (remaining.count() <= 0 || ! CAssertConfig::Get().GetExecutor()->WaitForUserInput(remaining))
+            {
+                CAssertConfig::Get().GetExecutor()->ShowMessage("Timeout: the headless action is applied.\n"sv);
+                return CAssertConfig::Get().GetHeadlessAction();
+            }
+        }
         char input =  CAssertConfig::Get().GetExecutor()->GetUserInput();
+        if (CHandlerExecutor::s_cNoInput == input)
+        {
+            CAssertConfig::Get().GetExecutor()->ShowMessage("No input: the headless action is applied.\n"sv);
+            return CAssertConfig::Get().GetHeadlessAction();
+        }
         auto actionIter = symbolToAction.find(input);
         if (std::end(symbolToAction) == actionIter)
         {
@@ -142,15 +316,10 @@ auto CAssertHandler::waitForUserDecision() -> EAssertAction
     }
 }
 
-void CAssertHandler::startDebugging()
-{
-    throw SStartDebuggingException { };
-}
-
 template void
 CAssertHandler::HandleAssert<EAssertLevel::Warning>(std::string, const char*, const char*, TLine, const char*);
 
-template void CAssertHandler::HandleAssert<EAssertLevel::Debug>(
+template bool CAssertHandler::HandleAssert<EAssertLevel::Debug>(
         std::string, const char*, const char*, TLine, const char*, bool&);
 
 template void
@@ -159,4 +328,7 @@ CAssertHandler::HandleAssert<EAssertLevel::Error>(std::string, const char*, cons
 template void
 CAssertHandler::HandleAssert<EAssertLevel::Fatal>(std::string, const char*, const char*, TLine, const char*);
 
+template void
+CAssertHandler::HandleAssert<EAssertLevel::Audit>(std::string, const char*, const char*, TLine, const char*);
+
 } // namespace dbgh::impl
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <type_traits>
 #include <memory>
 
@@ -26,30 +27,6 @@ class CAssertHandler
      */
     using TLine = decltype(__LINE__);
 
-    /**
-     * @internal
-     * @enum       EAssertAction
-     * @brief      This enum describes available action to debugging assert.
-     */
-    enum class EAssertAction
-    {
-        Abort,
-        Debug,
-        Ignore,
-        IgnoreForever,
-        Throw
-    }; // enum EAssertAction
-
-public:
-
-    /**
-     * @internal
-     * @struct     SStartDebuggingException
-     * @brief      The empty exception, using for the invite for start debugging.
-     */
-    struct SStartDebuggingException
-    {
-    };
 
 public:
     CAssertHandler() = delete;
@@ -93,11 +70,14 @@ public:
      * @param[in]  file          The filename that contains the code is a failed assertion.
      * @param[in]  line          The line number in the file that contains the code that is failed assertion.
      * @param[in]  function      The function that contains the code is a failed assertion.
+     * @param[in,out]  ignore    The ignore forever flag of the assertion site.
      *
      * @enum       T             The \ref EAssertLevel enum value, type of assert.
+     *
+     * @return     True if the user asked for the debugger, the assertion site breaks into it without throwing.
      */
     template<EAssertLevel T, std::enable_if_t<(EAssertLevel::Debug == T), int> = 0>
-    static void HandleAssert(
+    [[nodiscard]] static bool HandleAssert(
             std::string message, const char* expression, const char* file, TLine line, const char* function,
             bool& ignore);
 
@@ -118,6 +98,39 @@ public:
     static void HandleAssert(
             std::string message, const char* expression, const char* file, TLine line, const char* function);
 
+    /**
+     * @internal
+     * @brief      The internal handler for the assertion whose level is known only at runtime.
+     *              Calls the specialization of \ref HandleAssert for the level, the failed Debug assert is skipped
+     *              if ignore is set.
+     *
+     * @param[in]  level         The level of the assertion.
+     * @param[in]  message       The error description.
+     * @param[in]  expression    Expression to be evaluated, as a string.
+     * @param[in]  file          The filename that contains the code is a failed assertion.
+     * @param[in]  line          The line number in the file that contains the code that is failed assertion.
+     * @param[in]  function      The function that contains the code is a failed assertion.
+     * @param[in,out]  ignore    The ignore forever flag of the assertion site, used only by Debug assert.
+     *
+     * @return     True if the user asked for the debugger, the assertion site breaks into it.
+     */
+    [[nodiscard]] static bool HandleAssert(
+            EAssertLevel level, std::string message, const char* expression, const char* file, TLine line,
+            const char* function, bool& ignore);
+
+    /**
+     * @internal
+     * @brief      The internal handler for the failed verification, reported as Error assert without throwing.
+     *
+     * @param[in]  message       The error description.
+     * @param[in]  expression    Expression to be evaluated, as a string.
+     * @param[in]  file          The filename that contains the code is a failed assertion.
+     * @param[in]  line          The line number in the file that contains the code that is failed assertion.
+     * @param[in]  function      The function that contains the code is a failed assertion.
+     */
+    static void HandleVerify(
+            const std::string& message, const char* expression, const char* file, TLine line, const char* function);
+
     /**
      * @internal
      * @brief      The internal handler for the assertion.
@@ -135,23 +148,70 @@ public:
     static void HandleAssert(
             std::string message, const char* expression, const char* file, TLine line, const char* function);
 
+    /**
+     * @internal
+     * @brief      The internal handler for the assertion.
+     *             Template function specialization for Audit assert.
+     *
+     * @param[in]  message       The error description.
+     * @param[in]  expression    Expression to be evaluated, as a string.
+     * @param[in]  file          The filename that contains the code is a failed assertion.
+     * @param[in]  line          The line number in the file that contains the code that is failed assertion.
+     * @param[in]  function      The function that contains the code is a failed assertion.
+     *
+     * @enum       T             The \ref EAssertLevel enum value, type of assert.
+     */
+    template<EAssertLevel T, std::enable_if_t<(EAssertLevel::Audit == T), int> = 0>
+    static void HandleAssert(
+            std::string message, const char* expression, const char* file, TLine line, const char* function);
+
+    /**
+     * @internal
+     * @brief      The allocation-free handler for the fatal assertion, usable in signal handlers.
+     *
+     * @details    Writes the assertion information and the \ref dbgh::CAssertContext stack by raw write(2) to the
+     *              fatal descriptor from \ref dbgh::CAssertConfig (the standard error if it is not set), then calls
+     *              std::abort. The text is collected in the preallocated static buffer of \ref s_uFatalBufferSize
+     *              bytes, so the report of the usual size is written by one system call. If the buffer is already
+     *              used by another failing thread or by the interrupted code, a small buffer on the stack is used.
+     *
+     * @param[in]  message       The error description.
+     * @param[in]  expression    Expression to be evaluated, as a string.
+     * @param[in]  file          The filename that contains the code is a failed assertion.
+     * @param[in]  line          The line number in the file that contains the code that is failed assertion.
+     * @param[in]  function      The function that contains the code is a failed assertion.
+     */
+    [[noreturn]] static void HandleFatal(
+            const char* message, const char* expression, const char* file, TLine line, const char* function) noexcept;
+
+    /**
+     * @internal
+     * @brief      The size of the static buffer of the fatal path.
+     */
+    static constexpr std::size_t s_uFatalBufferSize = 4096;
+
 private:
 
     /**
      * @internal
-     * @brief      { function_description }
+     * @brief      Prompts the user for the action and waits for the decision.
      *
-     * @return     The e assert action.
+     * @param[in]  timeout  The maximal time of waiting, zero means without limit.
+     *
+     * @return     The chosen action, or the headless action from \ref dbgh::CAssertConfig if the time is out
+     *              or the input is closed.
      */
-    static EAssertAction waitForUserDecision();
+    static EAssertAction waitForUserDecision(std::chrono::milliseconds timeout);
 
     /**
      * @internal
-     * @brief      Starts a debugging.
+     * @brief      Records the failure in the failure log, the shared statistics and the probes.
      *
-     * @throw      SStartDebuggingException the signal for starting debugging.
+     * @details    Allocation-free, called by all handlers before the report is formatted.
      */
-    [[noreturn]] static void startDebugging();
+    static void recordFailure(
+            EAssertLevel level, const char* message, const char* expression, const char* file, TLine line,
+            const char* function) noexcept;
 
     /**
      * @internal
@@ -179,7 +239,7 @@ private:
 extern template void
 CAssertHandler::HandleAssert<EAssertLevel::Warning>(std::string, const char*, const char*, TLine, const char*);
 
-extern template void
+extern template bool
 CAssertHandler::HandleAssert<EAssertLevel::Debug>(std::string, const char*, const char*, TLine, const char*, bool&);
 
 extern template void
@@ -188,4 +248,7 @@ CAssertHandler::HandleAssert<EAssertLevel::Error>(std::string, const char*, cons
 extern template void
 CAssertHandler::HandleAssert<EAssertLevel::Fatal>(std::string, const char*, const char*, TLine, const char*);
 
+extern template void
+CAssertHandler::HandleAssert<EAssertLevel::Audit>(std::string, const char*, const char*, TLine, const char*);
+
 } // namespace dbgh
@@ -0,0 +1,128 @@
+/**
+ * @file        CAssertLimiter.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CAssertLimiter class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#ifdef __linux__
+#include <time.h>
+#endif
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @struct     SPeriodicSite
+ * @brief      The state of one \ref ASSERT_PERIODIC site.
+ */
+struct SPeriodicSite
+{
+    /**
+     * @brief      The coarse time in nanoseconds before which the expression is not evaluated.
+     */
+    std::atomic<std::uint64_t> m_uDeadline { 0 };
+
+    /**
+     * @brief      The ignore forever flag for the Debug level.
+     */
+    bool m_bIgnoreForever { false };
+};
+
+/**
+ * @internal
+ * @class      CAssertLimiter
+ * @brief      Decides which failures of the rate limited asserts (\ref ASSERT_ONCE, \ref ASSERT_FIRST_N,
+ *              \ref ASSERT_EVERY_N) are reported and when the expression of \ref ASSERT_PERIODIC is evaluated.
+ *
+ * @details    Every site owns one static atomic counter of its failures, shared by all threads. The failure is
+ *              counted by one relaxed fetch_add, so exactly the chosen failures are reported without a lock even
+ *              if the site fails on several threads at the same time. The periodic site owns the deadline of
+ *              the next evaluation, the thread which moves it forward evaluates the expression.
+ */
+class CAssertLimiter
+{
+public:
+    CAssertLimiter() = delete;
+
+    ~CAssertLimiter() = delete;
+
+    CAssertLimiter(CAssertLimiter&&) noexcept = delete;
+
+    CAssertLimiter(const CAssertLimiter&) = delete;
+
+    CAssertLimiter& operator=(CAssertLimiter&&) = delete;
+
+    CAssertLimiter& operator=(const CAssertLimiter&) = delete;
+
+    /**
+     * @brief      Counts the failure, returns true for the first count failures of the site.
+     *
+     * @param[in,out]  failures  The failure counter of the site.
+     * @param[in]      count     The count of the reported failures.
+     */
+    static bool IsFirstN(std::atomic<std::uint64_t>& failures, const std::uint64_t count) noexcept
+    {
+        return failures.fetch_add(1, std::memory_order_relaxed) < count;
+    }
+
+    /**
+     * @brief      Counts the failure, returns true for the first failure of the site and then for every period-th.
+     *
+     * @param[in,out]  failures  The failure counter of the site.
+     * @param[in]      period    The period of the reported failures, zero is handled as one.
+     */
+    static bool IsEveryN(std::atomic<std::uint64_t>& failures, const std::uint64_t period) noexcept
+    {
+        const auto failure = failures.fetch_add(1, std::memory_order_relaxed);
+        return period <= 1 || 0 == failure % period;
+    }
+
+    /**
+     * @brief      Returns true if the interval of the site is elapsed, only one thread gets true per interval.
+     *
+     * @details    The skip path reads the coarse clock once and loads the deadline. On Linux the clock is
+     *              CLOCK_MONOTONIC_COARSE which is read from the vDSO without a system call.
+     *
+     * @param[in,out]  site      The state of the site.
+     * @param[in]      interval  The minimal interval between the evaluations.
+     */
+    static bool IsDue(SPeriodicSite& site, const std::chrono::nanoseconds interval) noexcept
+    {
+        const auto now = CoarseNow();
+        auto deadline = site.m_uDeadline.load(std::memory_order_relaxed);
+        if (now < deadline)
+        {
+            return false;
+        }
+        return site.m_uDeadline.compare_exchange_strong(
+                deadline, now + static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(0, interval.count()))
+                , std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief      Reads the coarse monotonic clock in nanoseconds.
+     */
+    static std::uint64_t CoarseNow() noexcept
+    {
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+        timespec time { };
+        clock_gettime(CLOCK_MONOTONIC_COARSE, &time);
+        return static_cast<std::uint64_t>(time.tv_sec) * 1'000'000'000U + static_cast<std::uint64_t>(time.tv_nsec);
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+};
+
+} // namespace dbgh::impl
@@ -0,0 +1,136 @@
+/**
+ * @file        CAssertProfiler.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CAssertProfiler class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "CAssertProfiler.h"
+#include "CExpressionText.h"
+
+namespace dbgh
+{
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      The head of the profiled sites list.
+ */
+constinit std::atomic<impl::SProfileSite*> s_pSitesHead { nullptr };
+
+/**
+ * @internal
+ * @brief      True if the report at exit is registered.
+ */
+constinit std::atomic<bool> s_bReportRegistered { false };
+
+/**
+ * @internal
+ * @brief      The snapshot of one site for the report.
+ */
+struct SSiteCost
+{
+    const impl::SProfileSite* m_pSite;
+    std::uint64_t m_uEvaluations;
+    std::uint64_t m_uTotalNs;
+    std::uint64_t m_uMeanNs;
+};
+
+[[nodiscard]] const char* ToString(const EAssertLevel level)
+{
+    constexpr const char* arrNames[] { "WARNING", "DEBUG", "ERROR", "FATAL", "AUDIT" };
+    const auto index = static_cast<std::size_t>(level);
+    return index < std::size(arrNames) ? arrNames[index] : "UNKNOWN";
+}
+
+void WriteList(std::ostream& stream, const char* title, const std::vector<SSiteCost>& costs, const std::size_t count)
+{
+    stream << title << std::endl;
+    stream << std::right << std::setw(12) << "evaluations" << std::setw(14) << "total us"
+           << std::setw(12) << "mean ns" << "  " << std::left << std::setw(9) << "level" << "site" << std::endl;
+    for (std::size_t i = 0; i < std::min(count, costs.size()); ++i)
+    {
+        const auto& cost = costs[i];
+        stream << std::right << std::setw(12) << cost.m_uEvaluations << std::setw(14) << (cost.m_uTotalNs / 1000)
+               << std::setw(12) << cost.m_uMeanNs << "  " << std::left << std::setw(9) << ToString(cost.m_pSite->m_eLevel)
+               << cost.m_pSite->m_strFile << ":" << cost.m_pSite->m_iLine << " "
+               << (nullptr != cost.m_pSite->m_strFunction ? cost.m_pSite->m_strFunction : "") << ": "
+               << impl::CExpressionText::Decode(cost.m_pSite->m_strExpression) << std::endl;
+    }
+    stream << std::endl;
+}
+
+void ReportAtExit()
+{
+    CAssertProfiler::Report(std::cerr);
+}
+
+}  // unnamed namespace
+
+[[maybe_unused]] void CAssertProfiler::Report(std::ostream& stream, const std::size_t count)
+{
+    std::vector<SSiteCost> costs;
+    for (auto* site = s_pSitesHead.load(std::memory_order_acquire); nullptr != site; site = site->m_pNext)
+    {
+        const auto evaluations = site->m_uEvaluations.load(std::memory_order_relaxed);
+        if (0 == evaluations)
+        {
+            continue;
+        }
+        const auto totalNs = impl::CTsc::ToNanoseconds(site->m_uTicks.load(std::memory_order_relaxed));
+        costs.push_back({ site, evaluations, totalNs, totalNs / evaluations });
+    }
+    if (costs.empty())
+    {
+        return;
+    }
+
+    stream << "Assertion cost profile, " << costs.size() << " sites:" << std::endl << std::endl;
+    std::sort(std::begin(costs), std::end(costs), [](const SSiteCost& lhs, const SSiteCost& rhs)
+    {
+        return lhs.m_uTotalNs > rhs.m_uTotalNs;
+    });
+    WriteList(stream, "Top sites by total cost:", costs, count);
+    std::sort(std::begin(costs), std::end(costs), [](const SSiteCost& lhs, const SSiteCost& rhs)
+    {
+        return lhs.m_uMeanNs > rhs.m_uMeanNs;
+    });
+    WriteList(stream, "Top sites by mean cost:", costs, count);
+}
+
+[[maybe_unused]] void CAssertProfiler::Reset() noexcept
+{
+    for (auto* site = s_pSitesHead.load(std::memory_order_acquire); nullptr != site; site = site->m_pNext)
+    {
+        site->m_uEvaluations.store(0, std::memory_order_relaxed);
+        site->m_uTicks.store(0, std::memory_order_relaxed);
+    }
+}
+
+void CAssertProfiler::registerSite(impl::SProfileSite& site, const char* function) noexcept
+{
+    if (site.m_bRegistered.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+    site.m_strFunction = function;
+    site.m_pNext = s_pSitesHead.load(std::memory_order_relaxed);
+    while (! s_pSitesHead.compare_exchange_weak(site.m_pNext, &site, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+    if (! s_bReportRegistered.exchange(true, std::memory_order_relaxed))
+    {
+        std::atexit(&ReportAtExit);
+    }
+}
+
+} // namespace dbgh
@@ -0,0 +1,161 @@
+/**
+ * @file        CAssertProfiler.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CAssertProfiler class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#include "CAssertConfig.h"
+#include "CExpressionText.h"
+#include "CTsc.h"
+
+namespace dbgh
+{
+
+namespace impl
+{
+
+/**
+ * @internal
+ * @struct     SProfileSite
+ * @brief      The evaluation cost counters of one assertion site in the profiler mode.
+ */
+struct SProfileSite
+{
+    constexpr SProfileSite(EAssertLevel level, const char* expression, const char* file, TLine line) noexcept
+            : m_eLevel { level }
+            , m_strExpression { expression }
+            , m_strFile { file }
+            , m_iLine { line }
+    { }
+
+    SProfileSite(SProfileSite&&) noexcept = delete;
+
+    SProfileSite(const SProfileSite&) = delete;
+
+    SProfileSite& operator=(SProfileSite&&) noexcept = delete;
+
+    SProfileSite& operator=(const SProfileSite&) = delete;
+
+    const EAssertLevel m_eLevel;
+    const char* const m_strExpression;
+    const char* const m_strFile;
+    const TLine m_iLine;
+
+    /**
+     * @brief      The function that contains the assertion, set on the first evaluation.
+     */
+    const char* m_strFunction { nullptr };
+
+    std::atomic<std::uint64_t> m_uEvaluations { 0 };
+    std::atomic<std::uint64_t> m_uTicks { 0 };
+    std::atomic<bool> m_bRegistered { false };
+    SProfileSite* m_pNext { nullptr };
+};
+
+} // namespace impl
+
+
+/**
+ * @class      CAssertProfiler
+ * @brief      Measures the evaluation cost of the assertion expressions.
+ *
+ * @details    In the profiler mode (the DBGH_ASSERTS_PROFILE CMake option), every assertion site times the evaluation
+ *              of its expression by the time stamp counter and accumulates the count and the ticks in its own
+ *              counters. The report lists the most expensive sites by the total and by the mean cost, it is
+ *              written to std::cerr at exit and can be requested by \ref Report at any time.
+ *              Without the profiler mode the expressions are not measured and the report is empty.
+ *
+ * @example    dbgh::CAssertProfiler::Report(std::cout, 10);
+ */
+class CAssertProfiler
+{
+public:
+    CAssertProfiler() = delete;
+
+    ~CAssertProfiler() = delete;
+
+    CAssertProfiler(CAssertProfiler&&) noexcept = delete;
+
+    CAssertProfiler(const CAssertProfiler&) = delete;
+
+    CAssertProfiler& operator=(CAssertProfiler&&) = delete;
+
+    CAssertProfiler& operator=(const CAssertProfiler&) = delete;
+
+    /**
+     * @internal
+     * @brief      Evaluates the expression and accumulates its cost into the site counters.
+     *
+     * @param[in]  site        The site descriptor.
+     * @param[in]  function    The function that contains the assertion.
+     * @param[in]  expression  The callable which evaluates the expression.
+     *
+     * @return     The result of the expression.
+     */
+    template <typename TExpression>
+    static bool Evaluate(impl::SProfileSite& site, const char* function, const TExpression& expression)
+    {
+        const auto start = impl::CTsc::Now();
+        const bool bResult = bool(expression());
+        const auto ticks = impl::CTsc::Now() - start;
+        if (! site.m_bRegistered.load(std::memory_order_acquire))
+        {
+            registerSite(site, function);
+        }
+        site.m_uEvaluations.fetch_add(1, std::memory_order_relaxed);
+        site.m_uTicks.fetch_add(ticks, std::memory_order_relaxed);
+        return bResult;
+    }
+
+    /**
+     * @brief      Writes the most expensive assertion sites by the total and by the mean evaluation cost.
+     *
+     * @param[in]  stream  The output stream.
+     * @param[in]  count   The count of sites in each list.
+     */
+    [[maybe_unused]] static void Report(std::ostream& stream, std::size_t count = 20);
+
+    /**
+     * @brief      Clears the counters of all sites.
+     */
+    [[maybe_unused]] static void Reset() noexcept;
+
+private:
+
+    /**
+     * @internal
+     * @brief      Links the site into the list of profiled sites.
+     */
+    static void registerSite(impl::SProfileSite& site, const char* function) noexcept;
+};
+
+} // namespace dbgh
+
+
+#ifdef DBGH_ASSERTS_PROFILE
+
+/**
+ * @internal
+ * @brief      Evaluates the assertion expression and measures its cost.
+ */
+#define IMPL_DBGH_EVALUATE(_level_, _expression_, _text_)                                                                               \
+    dbgh::CAssertProfiler::Evaluate([]() -> dbgh::impl::SProfileSite& {                                                                 \
+        static constinit dbgh::impl::SProfileSite dbghProfile_ {                                                                        \
+                _level_, IMPL_DBGH_TEXT(_text_), IMPL_DBGH_FILE, __LINE__ };                                                            \
+        return dbghProfile_;                                                                                                            \
+    }(), __func__, [&]() -> bool { return bool(_expression_); })
+
+#else
+
+#define IMPL_DBGH_EVALUATE(_level_, _expression_, _text_) bool(_expression_)
+
+#endif
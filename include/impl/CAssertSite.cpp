@@ -0,0 +1,40 @@
+/**
+ * @file        CAssertSite.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CSiteRegistry class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include "CAssertSite.h"
+
+namespace dbgh::impl
+{
+
+namespace
+{
+/**
+ * @internal
+ * @brief      The head of the registered sites list.
+ */
+constinit std::atomic<SAssertSite*> s_pSitesHead { nullptr };
+}  // unnamed namespace
+
+void CSiteRegistry::registerSlow(SAssertSite& site) noexcept
+{
+    if (site.m_bRegistered.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+    site.m_pNext = s_pSitesHead.load(std::memory_order_relaxed);
+    while (! s_pSitesHead.compare_exchange_weak(site.m_pNext, &site, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+SAssertSite* CSiteRegistry::head() noexcept
+{
+    return s_pSitesHead.load(std::memory_order_acquire);
+}
+
+} // namespace dbgh::impl
@@ -0,0 +1,247 @@
+/**
+ * @file        CAssertSite.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for SAssertSite struct and CSiteRegistry class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#include "CAssertConfig.h"
+#include "CAssertException.h"
+#include "CCircuitBreaker.h"
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @struct     SAssertSite
+ * @brief      The static descriptor of one assertion site.
+ *
+ * @details    Every macro which needs per-site state places one constant-initialized instance of this struct
+ *              in the function that contains the assertion. The descriptor is linked into \ref CSiteRegistry
+ *              the first time the site is executed, after that it can be found and configured at runtime.
+ */
+struct SAssertSite
+{
+    constexpr SAssertSite(
+            EAssertLevel level, const char* expression, const char* file, TLine line, const char* function) noexcept
+            : m_eLevel { level }
+            , m_strExpression { expression }
+            , m_strFile { file }
+            , m_iLine { line }
+            , m_strFunction { function }
+    { }
+
+    SAssertSite(SAssertSite&&) noexcept = delete;
+
+    SAssertSite(const SAssertSite&) = delete;
+
+    SAssertSite& operator=(SAssertSite&&) noexcept = delete;
+
+    SAssertSite& operator=(const SAssertSite&) = delete;
+
+    /**
+     * @brief      The level of the assertion.
+     */
+    const EAssertLevel m_eLevel;
+
+    /**
+     * @brief      The expression of the assertion, as a string.
+     */
+    const char* const m_strExpression;
+
+    /**
+     * @brief      The filename that contains the assertion.
+     */
+    const char* const m_strFile;
+
+    /**
+     * @brief      The line number in the file that contains the assertion.
+     */
+    const TLine m_iLine;
+
+    /**
+     * @brief      The function that contains the assertion.
+     */
+    const char* const m_strFunction;
+
+    /**
+     * @brief      The per-site sampling rate for sampled asserts, zero means use the level default.
+     */
+    std::atomic<std::uint32_t> m_uSamplingRate { 0 };
+
+    /**
+     * @brief      The sampling rate chosen by \ref CAssertGovernor, zero means the site is not throttled.
+     */
+    std::atomic<std::uint32_t> m_uGovernedRate { 0 };
+
+    /**
+     * @internal
+     * @brief      The count and the ticks of the evaluations measured by \ref CAssertGovernor in the current window,
+     *              and the count of the executions covered by these evaluations (the sum of their sampling rates).
+     */
+    std::atomic<std::uint64_t> m_uEvaluations { 0 };
+    std::atomic<std::uint64_t> m_uTicks { 0 };
+    std::atomic<std::uint64_t> m_uExecutions { 0 };
+
+    /**
+     * @internal
+     * @brief      The circuit breaker state of the site, see \ref CCircuitBreaker.
+     */
+    SBreakerSite m_breaker;
+
+    /**
+     * @brief      The ignore forever flag for the sites reported as debug assert outside of the assert macro.
+     */
+    bool m_bIgnoreForever { false };
+
+    /**
+     * @internal
+     * @brief      True if the site is already linked into \ref CSiteRegistry.
+     */
+    std::atomic<bool> m_bRegistered { false };
+
+    /**
+     * @internal
+     * @brief      The next site in \ref CSiteRegistry.
+     */
+    SAssertSite* m_pNext { nullptr };
+};
+
+
+/**
+ * @internal
+ * @class      CSiteRegistry
+ * @brief      The lock-free list of all assertion sites that have been executed at least once.
+ */
+class CSiteRegistry
+{
+public:
+    CSiteRegistry() = delete;
+
+    ~CSiteRegistry() = delete;
+
+    CSiteRegistry(CSiteRegistry&&) noexcept = delete;
+
+    CSiteRegistry(const CSiteRegistry&) = delete;
+
+    CSiteRegistry& operator=(CSiteRegistry&&) = delete;
+
+    CSiteRegistry& operator=(const CSiteRegistry&) = delete;
+
+    /**
+     * @brief      Links the site into the registry if it is not linked yet.
+     *
+     * @param[in]  site  The site descriptor.
+     */
+    static void Register(SAssertSite& site) noexcept
+    {
+        if (! site.m_bRegistered.load(std::memory_order_acquire))
+        {
+            registerSlow(site);
+        }
+    }
+
+    /**
+     * @brief      Calls the given callable for every registered site whose file name ends with the given file
+     *              and whose line number equals the given line (zero matches every line).
+     *
+     * @param[in]  file      The file name or the tail of the file path.
+     * @param[in]  line      The line number, or zero.
+     * @param[in]  callable  The callable with signature void(SAssertSite&).
+     *
+     * @return     The count of matched sites.
+     */
+    template <typename TCallable>
+    static std::size_t ForEach(std::string_view file, TLine line, TCallable&& callable)
+    {
+        std::size_t count = 0;
+        for (auto* site = head(); nullptr != site; site = site->m_pNext)
+        {
+            if (std::string_view { site->m_strFile }.ends_with(file) && (0 == line || line == site->m_iLine))
+            {
+                callable(*site);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      Pushes the site to the head of the list.
+     */
+    static void registerSlow(SAssertSite& site) noexcept;
+
+    /**
+     * @internal
+     * @brief      Gets the first registered site.
+     */
+    static SAssertSite* head() noexcept;
+};
+
+
+/**
+ * @internal
+ * @class      CAssertSampler
+ * @brief      Decides which executions of a sampled assert must evaluate the expression.
+ */
+class CAssertSampler
+{
+public:
+    CAssertSampler() = delete;
+
+    ~CAssertSampler() = delete;
+
+    CAssertSampler(CAssertSampler&&) noexcept = delete;
+
+    CAssertSampler(const CAssertSampler&) = delete;
+
+    CAssertSampler& operator=(CAssertSampler&&) = delete;
+
+    CAssertSampler& operator=(const CAssertSampler&) = delete;
+
+    /**
+     * @brief      Counts down the thread-local per-site counter, returns true on 1-in-N executions.
+     *
+     * @details    The first execution on each thread is always evaluated. N is the rate chosen by the CPU budget
+     *              governor if the site is throttled, otherwise the per-site sampling rate if it is set, otherwise
+     *              the level default from \ref dbgh::CAssertConfig.
+     *
+     * @param[in]      site       The site descriptor.
+     * @param[in,out]  countdown  The thread-local counter of the site.
+     *
+     * @return     True if the expression must be evaluated, False otherwise.
+     */
+    static bool ShouldEvaluate(SAssertSite& site, std::uint32_t& countdown) noexcept
+    {
+        if (0 != countdown)
+        {
+            --countdown;
+            return false;
+        }
+        CSiteRegistry::Register(site);
+        auto rate = site.m_uGovernedRate.load(std::memory_order_relaxed);
+        if (0 == rate)
+        {
+            rate = site.m_uSamplingRate.load(std::memory_order_relaxed);
+        }
+        if (0 == rate)
+        {
+            rate = CAssertConfig::Get().GetSamplingRate(site.m_eLevel);
+        }
+        countdown = (0 == rate) ? 0 : rate - 1;
+        return true;
+    }
+};
+
+} // namespace dbgh::impl
@@ -0,0 +1,105 @@
+/**
+ * @file        CCircuitBreaker.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CCircuitBreaker class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <algorithm>
+#include <format>
+
+#include "CAssertHandler.h"
+#include "CAssertLimiter.h"
+#include "CCircuitBreaker.h"
+
+namespace dbgh::impl
+{
+
+namespace
+{
+
+constexpr std::uint64_t s_uNsPerMs = 1'000'000;
+
+constexpr std::uint32_t s_uWindowMs = 1000;
+
+} // unnamed namespace
+
+void CCircuitBreaker::SetPolicy(
+        const EAssertLevel level, const std::uint32_t threshold, const ECircuitAction action
+        , const std::chrono::milliseconds cooldown) noexcept
+{
+    const auto index = static_cast<std::size_t>(level);
+    s_arrActions[index].store(action, std::memory_order_relaxed);
+    s_arrCooldowns[index].store(
+            static_cast<std::uint64_t>(std::max<std::chrono::milliseconds::rep>(0, cooldown.count()))
+            , std::memory_order_relaxed);
+    s_arrThresholds[index].store(threshold, std::memory_order_relaxed);
+}
+
+bool CCircuitBreaker::count(
+        SBreakerSite& site, const EAssertLevel level, const char* expression, const char* file, const TLine line
+        , const char* function)
+{
+    const auto index = static_cast<std::size_t>(level);
+    const auto now = CAssertLimiter::CoarseNow();
+    if (now < site.m_uMutedUntil.load(std::memory_order_relaxed))
+    {
+        site.m_uSkipped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const auto skipped = site.m_uSkipped.exchange(0, std::memory_order_relaxed);
+    if (0 != skipped)
+    {
+        CAssertHandler::HandleAssert<EAssertLevel::Warning>(
+                std::format("The circuit breaker is closed, {} failures were skipped.", skipped)
+                , expression, file, line, function);
+    }
+
+    // The window start is kept modulo 2^32 milliseconds, the unsigned difference is still exact.
+    const auto nowMs = static_cast<std::uint32_t>(now / s_uNsPerMs);
+    auto window = site.m_uWindow.load(std::memory_order_relaxed);
+    std::uint64_t next;
+    do
+    {
+        const auto start = static_cast<std::uint32_t>(window >> 32U);
+        next = (0 != window && static_cast<std::uint32_t>(nowMs - start) < s_uWindowMs)
+               ? window + 1
+               : (static_cast<std::uint64_t>(nowMs) << 32U) + 1;
+    }
+    while (! site.m_uWindow.compare_exchange_weak(window, next, std::memory_order_relaxed));
+
+    const auto failures = static_cast<std::uint32_t>(next);
+    const auto threshold = s_arrThresholds[index].load(std::memory_order_relaxed);
+    if (0 == threshold || failures <= threshold)
+    {
+        return true;
+    }
+
+    if (ECircuitAction::Escalate == s_arrActions[index].load(std::memory_order_relaxed))
+    {
+        CAssertHandler::HandleAssert<EAssertLevel::Fatal>(
+                std::format("The circuit breaker is tripped, {} failures per second exceed the threshold {}."
+                            , failures, threshold)
+                , expression, file, line, function);
+        return false;
+    }
+
+    const auto cooldown = s_arrCooldowns[index].load(std::memory_order_relaxed);
+    auto mutedUntil = site.m_uMutedUntil.load(std::memory_order_relaxed);
+    if (now < mutedUntil
+        || ! site.m_uMutedUntil.compare_exchange_strong(mutedUntil, now + cooldown * s_uNsPerMs, std::memory_order_relaxed))
+    {
+        site.m_uSkipped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    site.m_uWindow.store(0, std::memory_order_relaxed);
+    CAssertHandler::HandleAssert<EAssertLevel::Warning>(
+            std::format("The circuit breaker is tripped, {} failures per second exceed the threshold {}, "
+                        "the site is muted for {} ms.", failures, threshold, cooldown)
+            , expression, file, line, function);
+    return false;
+}
+
+} // namespace dbgh::impl
@@ -0,0 +1,132 @@
+/**
+ * @file        CCircuitBreaker.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CCircuitBreaker class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "CAssertConfig.h"
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @struct     SBreakerSite
+ * @brief      The circuit breaker state of one assertion site.
+ */
+struct SBreakerSite
+{
+    /**
+     * @brief      The start of the current window in milliseconds (the high half) and the count of the failures
+     *              in the window (the low half), updated by one compare-exchange.
+     */
+    std::atomic<std::uint64_t> m_uWindow { 0 };
+
+    /**
+     * @brief      The coarse time in nanoseconds before which the failures are skipped.
+     */
+    std::atomic<std::uint64_t> m_uMutedUntil { 0 };
+
+    /**
+     * @brief      The count of the failures skipped while the site is muted, reported by the next failure of
+     *              the site after the cool-down.
+     */
+    std::atomic<std::uint64_t> m_uSkipped { 0 };
+};
+
+/**
+ * @internal
+ * @class      CCircuitBreaker
+ * @brief      Escalates or mutes the assertion sites which fail faster than the threshold of their level.
+ *
+ * @details    The breaker is consulted only after the expression is evaluated to false, the passed assertions
+ *              do not touch it. While the threshold of the level is zero, the failure costs one relaxed load.
+ */
+class CCircuitBreaker
+{
+public:
+    CCircuitBreaker() = delete;
+
+    ~CCircuitBreaker() = delete;
+
+    CCircuitBreaker(CCircuitBreaker&&) noexcept = delete;
+
+    CCircuitBreaker(const CCircuitBreaker&) = delete;
+
+    CCircuitBreaker& operator=(CCircuitBreaker&&) = delete;
+
+    CCircuitBreaker& operator=(const CCircuitBreaker&) = delete;
+
+    /**
+     * @brief      Sets the policy of the level, see \ref dbgh::CAssertConfig::SetCircuitBreaker.
+     */
+    static void SetPolicy(
+            EAssertLevel level, std::uint32_t threshold, ECircuitAction action, std::chrono::milliseconds cooldown) noexcept;
+
+    /**
+     * @brief      Counts the failure of the site and decides whether it is reported as usual.
+     *
+     * @details    If the breaker of the site trips, the escalation or the alert is reported here.
+     *
+     * @param[in,out]  site        The breaker state of the site.
+     * @param[in]      level       The level of the assertion.
+     * @param[in]      expression  The expression of the assertion.
+     * @param[in]      file        The filename that contains the assertion.
+     * @param[in]      line        The line number in the file that contains the assertion.
+     * @param[in]      function    The function that contains the assertion.
+     *
+     * @return     True if the failure must be reported by the assertion, False otherwise.
+     */
+    static bool ShouldReport(
+            SBreakerSite& site, const EAssertLevel level, const char* expression, const char* file, const TLine line
+            , const char* function)
+    {
+        if (0 == s_arrThresholds[static_cast<std::size_t>(level)].load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+        return count(site, level, expression, file, line, function);
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      Counts the failure in the window of the site, trips the breaker if the threshold is exceeded.
+     */
+    static bool count(
+            SBreakerSite& site, EAssertLevel level, const char* expression, const char* file, TLine line
+            , const char* function);
+
+    /**
+     * @internal
+     * @brief      The count of the failures per second of each level, zero if the breaker is disabled.
+     */
+    static constinit inline std::array<std::atomic<std::uint32_t>, static_cast<std::size_t>(EAssertLevel::END_ENUM_)>
+            s_arrThresholds { };
+
+    /**
+     * @internal
+     * @brief      The action of the tripped breaker of each level.
+     */
+    static constinit inline std::array<std::atomic<ECircuitAction>, static_cast<std::size_t>(EAssertLevel::END_ENUM_)>
+            s_arrActions { };
+
+    /**
+     * @internal
+     * @brief      The cool-down of the muted sites of each level, in milliseconds.
+     */
+    static constinit inline std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(EAssertLevel::END_ENUM_)>
+            s_arrCooldowns { };
+};
+
+} // namespace dbgh::impl
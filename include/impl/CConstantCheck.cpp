@@ -0,0 +1,22 @@
+/**
+ * @file        CConstantCheck.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CConstantCheck class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <cstdlib>
+
+#include "CConstantCheck.h"
+
+namespace dbgh::impl
+{
+
+void CConstantCheck::AssertionFailed([[maybe_unused]] const char* expression, [[maybe_unused]] const char* message) noexcept
+{
+    // Reached only during the constant evaluation, where the call itself is the error.
+    std::abort();
+}
+
+} // namespace dbgh::impl
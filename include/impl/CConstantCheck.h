@@ -0,0 +1,94 @@
+/**
+ * @file        CConstantCheck.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CConstantCheck class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include "CExpressionText.h"
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CConstantCheck
+ * @brief      The part of the assertions which works during the constant evaluation.
+ *
+ * @details    The assert macros can be used in the constexpr and consteval functions. During the constant evaluation,
+ *              the expression is checked without the configuration and the executor, and the failed assertion
+ *              calls \ref AssertionFailed, which is not constexpr, so the compiler stops with an error that shows the
+ *              expression and the message. At runtime, the assertions use the normal handler.
+ *
+ * @example    constexpr std::size_t ParseDigit(const char c)
+ *             {
+ *                 ASSERT_ERROR(c >= '0' && c <= '9', "The character is not a digit.");
+ *                 return static_cast<std::size_t>(c - '0');
+ *             }
+ */
+class CConstantCheck
+{
+public:
+    CConstantCheck() = delete;
+
+    ~CConstantCheck() = delete;
+
+    CConstantCheck(CConstantCheck&&) noexcept = delete;
+
+    CConstantCheck(const CConstantCheck&) = delete;
+
+    CConstantCheck& operator=(CConstantCheck&&) = delete;
+
+    CConstantCheck& operator=(const CConstantCheck&) = delete;
+
+    /**
+     * @brief      Determines whether the assertion is checked during the constant evaluation.
+     *
+     * @details    The wrapper keeps the compilers from warning that std::is_constant_evaluated is always false
+     *              in the non-constexpr functions which contain the assertions.
+     *
+     * @return     True during the constant evaluation, False at runtime.
+     */
+    [[nodiscard]] static constexpr bool IsConstantEvaluated() noexcept
+    {
+        return std::is_constant_evaluated();
+    }
+
+    /**
+     * @brief      Reports the assertion failed during the constant evaluation.
+     *
+     * @details    The function is deliberately not constexpr, its call makes the constant evaluation ill-formed,
+     *              the compiler reports it with the arguments. It is never called at runtime.
+     *
+     * @param[in]  expression  The expression of the assertion, as stored by the site (compressed with
+     *                          DBGH_ASSERTS_COMPRESS_EXPRESSIONS, the diagnostic still shows the source line).
+     * @param[in]  message     The message (the format string) of the assertion.
+     */
+    [[noreturn]] static void AssertionFailed(const char* expression, const char* message) noexcept;
+};
+
+} // namespace dbgh::impl
+
+
+/**
+ * @internal
+ * @brief      Gets the first of the macro arguments, the format string of the assertion message.
+ */
+#define IMPL_DBGH_FIRST_ARG(_first_, ...) _first_
+
+
+/**
+ * @internal
+ * @brief      Checks the assertion during the constant evaluation.
+ */
+#define IMPL_DBGH_CONSTANT_CHECK(_expression_, _text_, ...)                                                                             \
+    if ( ! bool(_expression_) )                                                                                                         \
+    {                                                                                                                                   \
+        dbgh::impl::CConstantCheck::AssertionFailed(IMPL_DBGH_TEXT(_text_), IMPL_DBGH_FIRST_ARG(__VA_ARGS__));                          \
+    }                                                                                                                                   \
+    (void) 0
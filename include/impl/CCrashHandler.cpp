@@ -0,0 +1,288 @@
+/**
+ * @file        CCrashHandler.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CCrashHandler class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#ifndef _WIN32
+#include <csignal>
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define DBGH_HAS_EXECINFO 1
+#endif
+#endif
+
+#include "CCrashHandler.h"
+#include "CAssertConfig.h"
+#include "CAssertContext.h"
+#include "CAssertSite.h"
+#include "CFailureLog.h"
+#include "CSafeWriter.h"
+
+namespace dbgh::impl
+{
+
+#ifndef _WIN32
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      The handled signals.
+ */
+constexpr int s_arrSignals[] { SIGSEGV, SIGBUS, SIGABRT, SIGFPE, SIGILL };
+
+constexpr std::size_t s_uSignalCount = std::size(s_arrSignals);
+
+/**
+ * @internal
+ * @brief      The maximal count of the dumped return addresses.
+ */
+constexpr int s_iMaxFrames = 64;
+
+/**
+ * @internal
+ * @brief      The size of the alternate signal stacks, big enough for the dump and the backtrace.
+ */
+constexpr std::size_t s_uAltStackSize = 64 * 1024;
+
+/**
+ * @internal
+ * @brief      The alternate signal stack of the thread which installs the handlers.
+ */
+alignas(16) char s_arrAltStack[s_uAltStackSize];
+
+/**
+ * @internal
+ * @brief      The buffer of the dump.
+ */
+char s_arrDumpBuffer[4096];
+
+/**
+ * @internal
+ * @brief      The handlers which were installed before, restored before the signal is raised again.
+ */
+struct sigaction s_arrPrevious[s_uSignalCount];
+
+/**
+ * @internal
+ * @brief      The file descriptor of the dump.
+ */
+constinit std::atomic<int> s_iDescriptor { 2 };
+
+/**
+ * @internal
+ * @brief      Set by the first crashed thread, the crashes during the dump are not dumped again.
+ */
+constinit std::atomic_flag s_bDumping;
+
+[[nodiscard]] const char* ToString(const int signal) noexcept
+{
+    switch (signal)
+    {
+        case SIGSEGV:
+            return "SIGSEGV";
+        case SIGBUS:
+            return "SIGBUS";
+        case SIGABRT:
+            return "SIGABRT";
+        case SIGFPE:
+            return "SIGFPE";
+        case SIGILL:
+            return "SIGILL";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+void RestoreAndRaise(const int signal) noexcept
+{
+    for (std::size_t i = 0; i < s_uSignalCount; ++i)
+    {
+        if (s_arrSignals[i] == signal)
+        {
+            sigaction(signal, &s_arrPrevious[i], nullptr);
+        }
+    }
+    raise(signal);
+}
+
+void DumpState(const int signal, const siginfo_t* info) noexcept
+{
+    CSafeWriter writer { s_iDescriptor.load(std::memory_order_relaxed), s_arrDumpBuffer, sizeof(s_arrDumpBuffer) };
+    writer.Write("CRASH: ").Write(ToString(signal)).Write(" (").WriteSigned(signal).Write(")");
+    if (nullptr != info && SIGABRT != signal)
+    {
+        writer.Write(" at address ").WriteHex(reinterpret_cast<std::uintptr_t>(info->si_addr));
+    }
+    writer.Write("\n");
+
+    writer.Write("  [levels]:       ");
+    constexpr const char* arrLevels[] { "WARNING", "DEBUG", "ERROR", "FATAL", "AUDIT" };
+    for (std::size_t i = 0; i < std::size(arrLevels); ++i)
+    {
+        const bool bActive = CAssertConfig::Get().IsEnabledAssert(static_cast<EAssertLevel>(i));
+        writer.Write(arrLevels[i]).Write(bActive ? "=on " : "=off ");
+    }
+    writer.Write("\n");
+
+    std::size_t siteCount = 0;
+    CSiteRegistry::ForEach({ }, 0, [&siteCount](const SAssertSite&) noexcept { ++siteCount; });
+    writer.Write("  [sites]:        ").WriteUnsigned(siteCount).Write(" registered\n");
+
+    writer.Write("  [failures]:     ").WriteUnsigned(CFailureLog::GetCount()).Write(" total\n");
+    CFailureLog::Dump(writer, "  [failure]:      ");
+    CAssertContext::Render(writer, "  [context]:      ");
+
+#ifdef DBGH_HAS_EXECINFO
+    void* arrFrames[s_iMaxFrames];
+    const auto frameCount = backtrace(arrFrames, s_iMaxFrames);
+    for (int i = 0; i < frameCount; ++i)
+    {
+        writer.Write("  [frame]:        ").WriteHex(reinterpret_cast<std::uintptr_t>(arrFrames[i])).Write("\n");
+    }
+#endif
+    writer.Write("\n");
+}
+
+/**
+ * @internal
+ * @class      CThreadAltStack
+ * @brief      The alternate signal stack of the other threads, allocated on \ref CCrashHandler::InstallForThread
+ *              and disabled before it is freed at the thread exit.
+ */
+class CThreadAltStack
+{
+public:
+    CThreadAltStack() = default;
+
+    ~CThreadAltStack()
+    {
+        if (nullptr != m_pStack)
+        {
+            stack_t disabled { };
+            disabled.ss_flags = SS_DISABLE;
+            sigaltstack(&disabled, nullptr);
+        }
+    }
+
+    CThreadAltStack(CThreadAltStack&&) noexcept = delete;
+
+    CThreadAltStack(const CThreadAltStack&) = delete;
+
+    CThreadAltStack& operator=(CThreadAltStack&&) = delete;
+
+    CThreadAltStack& operator=(const CThreadAltStack&) = delete;
+
+    bool Install() noexcept
+    {
+        stack_t current { };
+        if (0 == sigaltstack(nullptr, &current) && 0 == (current.ss_flags & SS_DISABLE))
+        {
+            // The thread already has the alternate stack, of the handlers or of its owner.
+            return true;
+        }
+        m_pStack.reset(new (std::nothrow) char[s_uAltStackSize]);
+        if (nullptr == m_pStack)
+        {
+            return false;
+        }
+        stack_t altStack { };
+        altStack.ss_sp = m_pStack.get();
+        altStack.ss_size = s_uAltStackSize;
+        altStack.ss_flags = 0;
+        if (0 != sigaltstack(&altStack, nullptr))
+        {
+            m_pStack.reset();
+            return false;
+        }
+        return true;
+    }
+
+private:
+    std::unique_ptr<char[]> m_pStack;
+};
+
+thread_local CThreadAltStack t_altStack;
+
+void HandleSignal(const int signal, siginfo_t* info, [[maybe_unused]] void* context)
+{
+    const auto savedErrno = errno;
+    if (! s_bDumping.test_and_set(std::memory_order_acq_rel))
+    {
+        DumpState(signal, info);
+    }
+    errno = savedErrno;
+    RestoreAndRaise(signal);
+}
+
+}  // unnamed namespace
+
+bool CCrashHandler::Install(const int descriptor) noexcept
+{
+    s_iDescriptor.store(descriptor, std::memory_order_relaxed);
+
+#ifdef DBGH_HAS_EXECINFO
+    // The first call of backtrace loads the unwinder, which allocates, so it is done here and not in the handler.
+    void* arrFrames[1];
+    backtrace(arrFrames, 1);
+#endif
+
+    stack_t altStack { };
+    altStack.ss_sp = s_arrAltStack;
+    altStack.ss_size = s_uAltStackSize;
+    altStack.ss_flags = 0;
+    if (0 != sigaltstack(&altStack, nullptr))
+    {
+        return false;
+    }
+
+    struct sigaction action { };
+    action.sa_sigaction = &HandleSignal;
+    action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+    for (std::size_t i = 0; i < s_uSignalCount; ++i)
+    {
+        struct sigaction previous { };
+        if (0 != sigaction(s_arrSignals[i], &action, &previous))
+        {
+            return false;
+        }
+        if (&HandleSignal != previous.sa_sigaction)
+        {
+            s_arrPrevious[i] = previous;
+        }
+    }
+    return true;
+}
+
+bool CCrashHandler::InstallForThread() noexcept
+{
+    return t_altStack.Install();
+}
+
+#else
+
+bool CCrashHandler::Install([[maybe_unused]] const int descriptor) noexcept
+{
+    return false;
+}
+
+bool CCrashHandler::InstallForThread() noexcept
+{
+    return false;
+}
+
+#endif
+
+} // namespace dbgh::impl
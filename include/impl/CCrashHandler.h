@@ -0,0 +1,59 @@
+/**
+ * @file        CCrashHandler.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CCrashHandler class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CCrashHandler
+ * @brief      The handlers of the crash signals which dump the assertion state before the process dies.
+ *
+ * @details    The handlers of SIGSEGV, SIGBUS, SIGABRT, SIGFPE and SIGILL run on the alternate signal stack and write
+ *              the signal, the enabled levels, the last failure records of \ref CFailureLog, the
+ *              \ref dbgh::CAssertContext stack and the raw return addresses of the crashed thread by
+ *              \ref CSafeWriter. Nothing is allocated or locked on that path. After the dump, the previous handler
+ *              of the signal is restored and the signal is raised again.
+ *              The alternate stack is per thread: \ref Install sets it for the calling thread, the other threads
+ *              call \ref InstallForThread, otherwise their stack overflows are not dumped.
+ */
+class CCrashHandler
+{
+public:
+    CCrashHandler() = delete;
+
+    ~CCrashHandler() = delete;
+
+    CCrashHandler(CCrashHandler&&) noexcept = delete;
+
+    CCrashHandler(const CCrashHandler&) = delete;
+
+    CCrashHandler& operator=(CCrashHandler&&) = delete;
+
+    CCrashHandler& operator=(const CCrashHandler&) = delete;
+
+    /**
+     * @brief      Installs the handlers and the alternate signal stack of the calling thread.
+     *
+     * @param[in]  descriptor  The file descriptor for the dump.
+     *
+     * @return     True if the handlers are installed, False if the platform does not support them.
+     */
+    static bool Install(int descriptor) noexcept;
+
+    /**
+     * @brief      Sets the alternate signal stack of the calling thread, freed at the thread exit.
+     *
+     * @return     True if the thread has the alternate stack, False otherwise.
+     */
+    static bool InstallForThread() noexcept;
+};
+
+} // namespace dbgh::impl
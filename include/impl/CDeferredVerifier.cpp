@@ -0,0 +1,252 @@
+/**
+ * @file        CDeferredVerifier.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CDeferredVerifier class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "CDeferredVerifier.h"
+#include "CAssertHandler.h"
+#include "CCircuitBreaker.h"
+#include "DBGHDebugBreak.h"
+
+namespace dbgh
+{
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+/**
+ * @internal
+ * @brief      The sleep of the verifier thread when the queue is empty.
+ */
+constexpr auto s_idleSleep = 1ms;
+
+constexpr std::uint64_t s_uSlotMask = CDeferredVerifier::s_uSlotCount - 1;
+static_assert(0 == (CDeferredVerifier::s_uSlotCount & s_uSlotMask), "The slot count must be a power of two.");
+
+/**
+ * @internal
+ * @brief      The position of the next slot for the producers.
+ */
+constinit std::atomic<std::uint64_t> s_uTail { 0 };
+
+/**
+ * @internal
+ * @brief      The position of the next slot for the verifier thread.
+ */
+constinit std::atomic<std::uint64_t> s_uHead { 0 };
+
+/**
+ * @internal
+ * @brief      The count of dropped checks.
+ */
+constinit std::atomic<std::uint64_t> s_uDropped { 0 };
+
+/**
+ * @internal
+ * @brief      True if the verifier thread is started.
+ */
+constinit std::atomic<bool> s_bStarted { false };
+
+/**
+ * @internal
+ * @class      CVerifierThread
+ * @brief      Owns the verifier thread, stops it after draining the queue at exit.
+ */
+class CVerifierThread
+{
+public:
+
+    template <typename TLoop>
+    explicit CVerifierThread(TLoop loop)
+        : m_thread { [this, loop] { loop(m_bStop); } }
+    { }
+
+    ~CVerifierThread()
+    {
+        m_bStop.store(true, std::memory_order_release);
+        m_thread.join();
+    }
+
+    CVerifierThread(CVerifierThread&&) noexcept = delete;
+
+    CVerifierThread(const CVerifierThread&) = delete;
+
+    CVerifierThread& operator=(CVerifierThread&&) = delete;
+
+    CVerifierThread& operator=(const CVerifierThread&) = delete;
+
+private:
+    std::atomic<bool> m_bStop { false };
+    std::thread m_thread;
+};
+
+#ifdef DBGH_ASSERTS_EXCEPTIONS
+/**
+ * @internal
+ * @brief      Logs the exception escaped from the deferred check, the exceptions of the executor are ignored.
+ */
+void LogException(const char* what) noexcept
+{
+    try
+    {
+        CAssertConfig::Get().GetExecutor()->Logs(what);
+    }
+    catch (...)
+    {
+    }
+}
+#endif
+
+}  // unnamed namespace
+
+constinit CDeferredVerifier::SSlot CDeferredVerifier::s_arrSlots[CDeferredVerifier::s_uSlotCount] { };
+
+auto CDeferredVerifier::acquireSlot() noexcept -> SSlot*
+{
+    if (! s_bStarted.load(std::memory_order_acquire) && ! startVerifier())
+    {
+        s_uDropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    auto position = s_uTail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        auto& slot = s_arrSlots[position & s_uSlotMask];
+        const auto sequence = slot.m_uSequence.load(std::memory_order_acquire);
+        const auto expected = position - (position & s_uSlotMask);
+        if (sequence == expected)
+        {
+            if (s_uTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot.m_uPosition = position;
+                return &slot;
+            }
+        }
+        else if (sequence < expected)
+        {
+            s_uDropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        else
+        {
+            position = s_uTail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void CDeferredVerifier::publishSlot(SSlot* slot) noexcept
+{
+    slot->m_uSequence.store(slot->m_uPosition + 1 - (slot->m_uPosition & s_uSlotMask), std::memory_order_release);
+}
+
+bool CDeferredVerifier::startVerifier() noexcept
+{
+    static std::once_flag onceFlag;
+    IMPL_DBGH_TRY
+    {
+        std::call_once(onceFlag, []
+        {
+            static CVerifierThread verifierThread { [](const std::atomic<bool>& stop)
+            {
+                for (;;)
+                {
+                    if (! verifyNext())
+                    {
+                        if (stop.load(std::memory_order_acquire))
+                        {
+                            return;
+                        }
+                        std::this_thread::sleep_for(s_idleSleep);
+                    }
+                }
+            } };
+            s_bStarted.store(true, std::memory_order_release);
+        });
+    }
+    IMPL_DBGH_CATCH(...)
+    {
+        // The thread can not be created, for example the process is out of threads. The once flag stays unset.
+    }
+    return s_bStarted.load(std::memory_order_acquire);
+}
+
+bool CDeferredVerifier::verifyNext() noexcept
+{
+    const auto position = s_uHead.load(std::memory_order_relaxed);
+    auto& slot = s_arrSlots[position & s_uSlotMask];
+    const auto base = position - (position & s_uSlotMask);
+    if (slot.m_uSequence.load(std::memory_order_acquire) != base + 1)
+    {
+        return false;
+    }
+
+#ifdef DBGH_ASSERTS_EXCEPTIONS
+    try
+    {
+        slot.m_fnVerify(*slot.m_pSite, slot.m_arrPayload);
+    }
+    catch (const std::exception& e)
+    {
+        LogException(e.what());
+    }
+    catch (...)
+    {
+        LogException("The deferred assert is failed with an unknown exception.");
+    }
+#else
+    slot.m_fnVerify(*slot.m_pSite, slot.m_arrPayload);
+#endif
+
+    slot.m_uSequence.store(base + s_uSlotCount, std::memory_order_release);
+    s_uHead.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+void CDeferredVerifier::Flush() noexcept
+{
+    const auto tail = s_uTail.load(std::memory_order_acquire);
+    while (s_uHead.load(std::memory_order_acquire) < tail)
+    {
+        std::this_thread::sleep_for(s_idleSleep);
+    }
+}
+
+std::uint64_t CDeferredVerifier::GetDroppedCount() noexcept
+{
+    return s_uDropped.load(std::memory_order_relaxed);
+}
+
+void CDeferredVerifier::reportFailure(const EAssertLevel level, impl::SAssertSite& site, std::string message)
+{
+    using impl::CAssertHandler;
+    IMPL_DBGH_TRY
+    {
+        if (! impl::CCircuitBreaker::ShouldReport(
+                site.m_breaker, level, site.m_strExpression, site.m_strFile, site.m_iLine, site.m_strFunction))
+        {
+            return;
+        }
+        if (CAssertHandler::HandleAssert(level, std::move(message), site.m_strExpression, site.m_strFile, site.m_iLine
+                                         , site.m_strFunction, site.m_bIgnoreForever))
+        {
+            START_DEBUGGING;
+        }
+    }
+    IMPL_DBGH_CATCH(const CAssertException&)
+    {
+        // The failure is already reported, there is no caller to receive the exception.
+    }
+}
+
+} // namespace dbgh
@@ -0,0 +1,211 @@
+/**
+ * @file        CDeferredVerifier.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CDeferredVerifier class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <new>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "CAssertConfig.h"
+#include "CAssertSite.h"
+
+namespace dbgh
+{
+
+/**
+ * @class      CDeferredVerifier
+ * @brief      Verifies the deferred asserts (\ref ASSERT_DEFERRED) on the background thread.
+ *
+ * @details    The asserting thread copies the snapshot, the predicate and the format arguments into a preallocated
+ *              slot of a bounded lock-free queue and continues. The verifier thread evaluates the predicate and
+ *              reports the failures through the usual handler with the site information of the assert.
+ *              If the queue is full or the verifier thread can not be started, the check is dropped and counted,
+ *              the asserting thread never waits.
+ *              The verifier thread is started on the first deferred assert and drains the queue at exit.
+ */
+class CDeferredVerifier
+{
+public:
+
+    /**
+     * @brief      The count of slots in the queue.
+     */
+    static constexpr std::size_t s_uSlotCount = 1024;
+
+    /**
+     * @brief      The maximal size of the snapshot, the predicate and the format arguments together.
+     */
+    static constexpr std::size_t s_uPayloadSize = 128;
+
+    CDeferredVerifier() = delete;
+
+    ~CDeferredVerifier() = delete;
+
+    CDeferredVerifier(CDeferredVerifier&&) noexcept = delete;
+
+    CDeferredVerifier(const CDeferredVerifier&) = delete;
+
+    CDeferredVerifier& operator=(CDeferredVerifier&&) = delete;
+
+    CDeferredVerifier& operator=(const CDeferredVerifier&) = delete;
+
+    /**
+     * @internal
+     * @brief      Copies the check into the queue.
+     *
+     * @param[in]  site       The site descriptor of the assert.
+     * @param[in]  snapshot   The trivially copyable snapshot, the predicate argument.
+     * @param[in]  predicate  The trivially copyable predicate with signature bool(const TSnapshot&).
+     * @param[in]  format     The format string, checked against the arguments at compile time.
+     * @param[in]  args       The trivially copyable format arguments.
+     *
+     * @return     True if the check is enqueued, False if it is dropped because the queue is full.
+     */
+    template <EAssertLevel TLevel, typename TSnapshot, typename TPredicate, typename... TArgs>
+    static bool Enqueue(
+            impl::SAssertSite& site, const TSnapshot& snapshot, TPredicate predicate,
+            std::format_string<const std::decay_t<TArgs>&...> format, const TArgs&... args) noexcept
+    {
+        using TPayload = SPayload<TPredicate, TSnapshot, std::decay_t<TArgs>...>;
+        static_assert(std::is_trivially_copyable_v<TSnapshot>, "The deferred snapshot must be trivially copyable.");
+        static_assert(std::is_trivially_copyable_v<TPredicate>, "The deferred predicate must be trivially copyable.");
+        static_assert((std::is_trivially_copyable_v<std::decay_t<TArgs>> && ...)
+                      , "The deferred format arguments must be trivially copyable.");
+        static_assert(sizeof(TPayload) <= s_uPayloadSize && alignof(TPayload) <= alignof(std::max_align_t)
+                      , "The deferred snapshot is too large.");
+
+        auto* slot = acquireSlot();
+        if (nullptr == slot)
+        {
+            return false;
+        }
+        slot->m_pSite = &site;
+        slot->m_fnVerify = &verify<TLevel, TPayload>;
+        ::new (static_cast<void*>(slot->m_arrPayload)) TPayload { predicate, snapshot, { args... }, format };
+        publishSlot(slot);
+        return true;
+    }
+
+    /**
+     * @brief      Waits until all enqueued deferred asserts are verified.
+     */
+    [[maybe_unused]] static void Flush() noexcept;
+
+    /**
+     * @brief      Gets the count of deferred asserts dropped because the queue was full.
+     *
+     * @return     The count of dropped checks.
+     */
+    [[nodiscard]] static std::uint64_t GetDroppedCount() noexcept;
+
+private:
+
+    /**
+     * @internal
+     * @brief      The type-erased verification of one slot.
+     */
+    using TVerifyFn = void (*)(impl::SAssertSite& site, void* payload);
+
+    /**
+     * @internal
+     * @brief      The data copied into the slot.
+     */
+    template <typename TPredicate, typename TSnapshot, typename... TArgs>
+    struct SPayload
+    {
+        TPredicate m_predicate;
+        TSnapshot m_snapshot;
+        std::tuple<TArgs...> m_tupArgs;
+        std::format_string<const TArgs&...> m_format;
+    };
+
+    /**
+     * @internal
+     * @brief      One slot of the queue.
+     */
+    struct SSlot
+    {
+        /**
+         * @brief  The sequence of the slot minus the slot index, zero-initialized state is the empty queue.
+         */
+        std::atomic<std::uint64_t> m_uSequence;
+        std::uint64_t m_uPosition;
+        impl::SAssertSite* m_pSite;
+        TVerifyFn m_fnVerify;
+        alignas(std::max_align_t) std::byte m_arrPayload[s_uPayloadSize];
+    };
+
+    /**
+     * @internal
+     * @brief      Evaluates the predicate and reports the failure.
+     */
+    template <EAssertLevel TLevel, typename TPayload>
+    static void verify(impl::SAssertSite& site, void* storage)
+    {
+        auto& payload = *std::launder(static_cast<TPayload*>(storage));
+        if (! bool(payload.m_predicate(std::as_const(payload.m_snapshot))))
+        {
+            reportFailure(TLevel, site, std::apply([&payload](const auto&... args)
+            {
+                return std::format(payload.m_format, args...);
+            }, payload.m_tupArgs));
+        }
+        payload.~TPayload();
+    }
+
+    /**
+     * @internal
+     * @brief      The preallocated slots of the queue.
+     */
+    static SSlot s_arrSlots[s_uSlotCount];
+
+    /**
+     * @internal
+     * @brief      Reserves the next slot of the queue for writing.
+     *
+     * @return     The reserved slot, or nullptr if the queue is full or the verifier thread can not be started.
+     */
+    static SSlot* acquireSlot() noexcept;
+
+    /**
+     * @internal
+     * @brief      Makes the written slot visible for the verifier thread.
+     */
+    static void publishSlot(SSlot* slot) noexcept;
+
+    /**
+     * @internal
+     * @brief      Starts the verifier thread once, the failed start is retried by the next call.
+     *
+     * @return     True if the verifier thread is running, False otherwise.
+     */
+    static bool startVerifier() noexcept;
+
+    /**
+     * @internal
+     * @brief      Verifies the next slot of the queue on the verifier thread.
+     *
+     * @return     True if a slot is verified, False if the queue is empty.
+     */
+    static bool verifyNext() noexcept;
+
+    /**
+     * @internal
+     * @brief      Reports the failure of the deferred assert on the verifier thread.
+     */
+    static void reportFailure(EAssertLevel level, impl::SAssertSite& site, std::string message);
+};
+
+} // namespace dbgh
@@ -0,0 +1,110 @@
+/**
+ * @file        CExpressionText.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CExpressionText class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "CExpressionText.h"
+
+namespace dbgh::impl
+{
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      The decompressed texts by the compressed ones, the nodes are never removed.
+ *
+ * @details    The map is never destroyed, the reports printed at the exit decompress the texts too.
+ */
+std::map<const char*, std::string>& DecodedTexts()
+{
+    static auto* s_pTexts = new std::map<const char*, std::string>;
+    return *s_pTexts;
+}
+
+/**
+ * @internal
+ * @brief      The mutex of the decompressed texts.
+ */
+std::mutex s_mtxTexts;
+
+}  // unnamed namespace
+
+const char* CExpressionText::Decode(const char* text, char* buffer, const std::size_t size) noexcept
+{
+    std::size_t length = 0;
+    const auto append = [buffer, size, &length](const std::string_view piece) noexcept
+    {
+        for (const auto c : piece)
+        {
+            if (length + 1 < size)
+            {
+                buffer[length++] = c;
+            }
+        }
+    };
+    if (! IsCompressed(text))
+    {
+        append(nullptr != text ? std::string_view { text } : std::string_view { });
+    }
+    else
+    {
+        for (const auto* position = text + 1; '\0' != *position; ++position)
+        {
+            const auto code = static_cast<unsigned char>(*position);
+            if (s_uEscape == code && '\0' != position[1])
+            {
+                append({ ++position, 1 });
+            }
+            else if (isEntry(code))
+            {
+                append(s_arrDictionary[code - s_uFirstCode]);
+            }
+            else
+            {
+                append({ position, 1 });
+            }
+        }
+    }
+    buffer[length] = '\0';
+    return buffer;
+}
+
+const char* CExpressionText::Decode(const char* text)
+{
+    if (! IsCompressed(text))
+    {
+        return text;
+    }
+    const std::lock_guard lock { s_mtxTexts };
+    auto& decoded = DecodedTexts()[text];
+    if (decoded.empty())
+    {
+        std::size_t size = 1;
+        for (const auto* position = text + 1; '\0' != *position; ++position)
+        {
+            const auto code = static_cast<unsigned char>(*position);
+            size += isEntry(code) ? s_arrDictionary[code - s_uFirstCode].size() : 1;
+        }
+        decoded.resize(size);
+        Decode(text, decoded.data(), size);
+        decoded.resize(std::strlen(decoded.data()));
+        decoded.shrink_to_fit();
+        if (decoded.empty())
+        {
+            return "";
+        }
+    }
+    return decoded.c_str();
+}
+
+} // namespace dbgh::impl
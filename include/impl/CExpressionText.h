@@ -0,0 +1,248 @@
+/**
+ * @file        CExpressionText.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CExpressionText class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @struct     SFixedText
+ * @brief      The string literal as the template argument.
+ */
+template <std::size_t TSize>
+struct SFixedText
+{
+    consteval SFixedText(const char (&text)[TSize]) noexcept
+    {
+        for (std::size_t i = 0; i < TSize; ++i)
+        {
+            m_arrText[i] = text[i];
+        }
+    }
+
+    [[nodiscard]] constexpr std::string_view View() const noexcept
+    {
+        return { m_arrText, TSize - 1 };
+    }
+
+    char m_arrText[TSize] { };
+};
+
+
+/**
+ * @internal
+ * @class      CExpressionText
+ * @brief      The compressed expression texts of the assertion sites.
+ *
+ * @details    With DBGH_ASSERTS_COMPRESS_EXPRESSIONS every expression text is compressed at compile time, the
+ *              string literal itself is not emitted. The frequent C++ tokens and letter pairs are replaced by one
+ *              byte codes of \ref s_arrDictionary, the compressed text starts with \ref s_cMarker.
+ *              The text is decompressed only when a report is rendered, the plain texts pass unchanged.
+ */
+class CExpressionText
+{
+public:
+    CExpressionText() = delete;
+
+    ~CExpressionText() = delete;
+
+    CExpressionText(CExpressionText&&) noexcept = delete;
+
+    CExpressionText(const CExpressionText&) = delete;
+
+    CExpressionText& operator=(CExpressionText&&) = delete;
+
+    CExpressionText& operator=(const CExpressionText&) = delete;
+
+    /**
+     * @brief      The first byte of the compressed text.
+     */
+    static constexpr char s_cMarker = '\x01';
+
+    /**
+     * @brief      The code of the next byte which is copied as is.
+     */
+    static constexpr unsigned char s_uEscape = 0xFF;
+
+    /**
+     * @brief      The code of the first dictionary entry.
+     */
+    static constexpr unsigned char s_uFirstCode = 0x80;
+
+    /**
+     * @brief      The substrings replaced by one byte codes, at most 127 entries.
+     */
+    static constexpr std::string_view s_arrDictionary[] = {
+            " == ", " != ", " <= ", " >= ", " < ", " > ", " && ", " || ", " + ", " - ", " * ", " / ", " % ",
+            "nullptr", "std::", "::", "->", "()", ".size()", ".empty()", "size", "count", "index", "value",
+            "length", "begin", "end", "true", "false", "const", "static_cast<", "sizeof(", "this->", "m_",
+            "m_p", "m_u", "m_i", "m_str", "m_arr", "m_b", "Is", "Get", "capacity", "data", "ptr", "null",
+            "in", "er", "re", "on", "at", "st", "en", "nt", "es", "te", "al", "ar", "or", "ed", "le", "ex", "co",
+            "ou", "it", "ti", "ra", "se", "ve", "de", "ng", "ue", "ze", "is", "ro", "ri", "ne", "ea", "ch", "to",
+            "Si", "Co", "Va", "In", "Ex", "Re", "Le", "Fi", "um", "ca", "li", "ma", "ta", "si", "el", "ll", "ic",
+            "pe", "ac", "ce", "ut", "ab", "ad", "ge", "ur", "he", "ha", "ck", "ck(", "ss", "ul", "pt", "rr", "et",
+            "(0)", " 0", " 1", "0)", "[i]", "i]", "s_", "::s_", ", ", "))", "!(", "! ",
+    };
+
+    static_assert(std::size(s_arrDictionary) <= s_uEscape - s_uFirstCode);
+
+    /**
+     * @brief      Checks if the text is compressed.
+     */
+    [[nodiscard]] static constexpr bool IsCompressed(const char* text) noexcept
+    {
+        return nullptr != text && s_cMarker == text[0];
+    }
+
+    /**
+     * @brief      Computes the size of the compressed text with the marker and the terminating zero.
+     */
+    [[nodiscard]] static consteval std::size_t CompressedSize(const std::string_view text) noexcept
+    {
+        std::size_t size = 2;
+        for (std::size_t position = 0; position < text.size(); ++size)
+        {
+            std::size_t length = 0;
+            if (s_uEscape != match(text, position, length))
+            {
+                position += length;
+                continue;
+            }
+            size += needsEscape(text[position]) ? 1 : 0;
+            ++position;
+        }
+        return size;
+    }
+
+    /**
+     * @brief      Compresses the text, the result size is \ref CompressedSize.
+     */
+    template <std::size_t TSize>
+    [[nodiscard]] static consteval std::array<char, TSize> Compress(const std::string_view text) noexcept
+    {
+        std::array<char, TSize> arrResult { };
+        std::size_t size = 0;
+        arrResult[size++] = s_cMarker;
+        for (std::size_t position = 0; position < text.size();)
+        {
+            std::size_t length = 0;
+            const auto code = match(text, position, length);
+            if (s_uEscape != code)
+            {
+                arrResult[size++] = static_cast<char>(code);
+                position += length;
+                continue;
+            }
+            if (needsEscape(text[position]))
+            {
+                arrResult[size++] = static_cast<char>(s_uEscape);
+            }
+            arrResult[size++] = text[position++];
+        }
+        return arrResult;
+    }
+
+    /**
+     * @brief      Decompresses the text into the buffer, async-signal-safe.
+     *
+     * @details    The plain text is copied. The result is truncated to the buffer size and always terminated.
+     *
+     * @param[in]  text    The compressed or plain text.
+     * @param[out] buffer  The buffer.
+     * @param[in]  size    The size of the buffer, at least one.
+     *
+     * @return     The buffer.
+     */
+    static const char* Decode(const char* text, char* buffer, std::size_t size) noexcept;
+
+    /**
+     * @brief      Decompresses the text once and keeps the result until the exit, not async-signal-safe.
+     *
+     * @param[in]  text  The compressed or plain text.
+     *
+     * @return     The plain text, the same pointer if the text is not compressed.
+     */
+    static const char* Decode(const char* text);
+
+private:
+
+    [[nodiscard]] static constexpr bool needsEscape(const char c) noexcept
+    {
+        return static_cast<unsigned char>(c) >= s_uFirstCode || s_cMarker == c;
+    }
+
+    [[nodiscard]] static constexpr bool isEntry(const unsigned char code) noexcept
+    {
+        return code >= s_uFirstCode && static_cast<std::size_t>(code) - s_uFirstCode < std::size(s_arrDictionary);
+    }
+
+    /**
+     * @internal
+     * @brief      Finds the longest dictionary entry at the position.
+     *
+     * @return     The code of the entry, \ref s_uEscape if nothing is found.
+     */
+    [[nodiscard]] static constexpr unsigned char match(
+            const std::string_view text, const std::size_t position, std::size_t& length) noexcept
+    {
+        auto code = s_uEscape;
+        for (std::size_t i = 0; i < std::size(s_arrDictionary); ++i)
+        {
+            const auto entry = s_arrDictionary[i];
+            if (entry.size() > length && text.substr(position).starts_with(entry))
+            {
+                length = entry.size();
+                code = static_cast<unsigned char>(s_uFirstCode + i);
+            }
+        }
+        return code;
+    }
+};
+
+/**
+ * @internal
+ * @struct     SCompressedText
+ * @brief      The compressed text of one string literal, emitted once per program.
+ */
+template <SFixedText TText>
+struct SCompressedText
+{
+    static constexpr auto s_arrData = CExpressionText::Compress<CExpressionText::CompressedSize(TText.View())>(TText.View());
+};
+
+} // namespace dbgh::impl
+
+
+/**
+ * @internal
+ * @brief      The expression text stored in the assertion site, compressed with DBGH_ASSERTS_COMPRESS_EXPRESSIONS.
+ */
+#ifdef DBGH_ASSERTS_COMPRESS_EXPRESSIONS
+#define IMPL_DBGH_TEXT(_text_)  (dbgh::impl::SCompressedText<_text_>::s_arrData.data())
+#else
+#define IMPL_DBGH_TEXT(_text_)  _text_
+#endif
+
+
+/**
+ * @internal
+ * @brief      The file name stored in the assertion site. With DBGH_ASSERTS_FILE_NAME only the base name of the file
+ *              is stored if the compiler provides __FILE_NAME__, the directories can also be stripped by
+ *              -fmacro-prefix-map (the DBGH_ASSERTS_STRIP_SOURCE_ROOT CMake option).
+ */
+#if defined(DBGH_ASSERTS_FILE_NAME) && defined(__FILE_NAME__)
+#define IMPL_DBGH_FILE          __FILE_NAME__
+#else
+#define IMPL_DBGH_FILE          __FILE__
+#endif
@@ -0,0 +1,142 @@
+/**
+ * @file        CFailureLatency.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CFailureLatency class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <array>
+#include <atomic>
+#include <bit>
+
+#include "CFailureLatency.h"
+
+namespace dbgh
+{
+
+namespace
+{
+
+constexpr std::size_t s_uLevelCount = static_cast<std::size_t>(EAssertLevel::END_ENUM_);
+constexpr std::size_t s_uPhaseCount = static_cast<std::size_t>(EFailurePhase::END_ENUM_);
+
+/**
+ * @internal
+ * @brief      The count of the linear buckets and the count of the buckets per power of two.
+ */
+constexpr std::size_t s_uLinearBuckets = 16;
+constexpr std::size_t s_uSubBuckets = 8;
+constexpr unsigned s_uSubBucketBits = 3;
+
+/**
+ * @internal
+ * @brief      One histogram.
+ */
+struct SHistogram
+{
+    std::atomic<std::uint64_t> m_arrBuckets[CFailureLatency::s_uBucketCount];
+    std::atomic<std::uint64_t> m_uMax;
+};
+
+constinit SHistogram s_arrHistograms[s_uLevelCount][s_uPhaseCount] { };
+
+[[nodiscard]] constexpr std::size_t BucketIndex(const std::uint64_t ticks) noexcept
+{
+    if (ticks < s_uLinearBuckets)
+    {
+        return static_cast<std::size_t>(ticks);
+    }
+    const auto exponent = static_cast<unsigned>(std::bit_width(ticks)) - 1;
+    const auto subBucket = static_cast<std::size_t>((ticks >> (exponent - s_uSubBucketBits)) & (s_uSubBuckets - 1));
+    return s_uLinearBuckets + (exponent - 4) * s_uSubBuckets + subBucket;
+}
+
+[[nodiscard]] constexpr std::uint64_t BucketUpperBound(const std::size_t index) noexcept
+{
+    if (index < s_uLinearBuckets)
+    {
+        return index;
+    }
+    const auto exponent = static_cast<unsigned>((index - s_uLinearBuckets) / s_uSubBuckets + 4);
+    const auto subBucket = static_cast<std::uint64_t>((index - s_uLinearBuckets) % s_uSubBuckets);
+    const auto width = std::uint64_t { 1 } << (exponent - s_uSubBucketBits);
+    return (s_uSubBuckets + subBucket) * width + (width - 1);
+}
+
+static_assert(CFailureLatency::s_uBucketCount == BucketIndex(~std::uint64_t { 0 }) + 1);
+static_assert(BucketIndex(BucketUpperBound(100)) == 100 && BucketIndex(BucketUpperBound(100) + 1) == 101);
+
+[[nodiscard]] SHistogram& Histogram(const EAssertLevel level, const EFailurePhase phase) noexcept
+{
+    return s_arrHistograms[static_cast<std::size_t>(level)][static_cast<std::size_t>(phase)];
+}
+
+}  // unnamed namespace
+
+SLatencySummary CFailureLatency::GetSummary(const EAssertLevel level, const EFailurePhase phase) noexcept
+{
+    auto& histogram = Histogram(level, phase);
+    std::array<std::uint64_t, s_uBucketCount> arrBuckets { };
+    std::uint64_t count = 0;
+    for (std::size_t i = 0; i < s_uBucketCount; ++i)
+    {
+        arrBuckets[i] = histogram.m_arrBuckets[i].load(std::memory_order_relaxed);
+        count += arrBuckets[i];
+    }
+
+    SLatencySummary summary { };
+    summary.m_uCount = count;
+    if (0 == count)
+    {
+        return summary;
+    }
+
+    const auto percentile = [&arrBuckets, count](const std::uint64_t perMille)
+    {
+        const auto rank = (count * perMille + 999) / 1000;
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < s_uBucketCount; ++i)
+        {
+            cumulative += arrBuckets[i];
+            if (cumulative >= rank)
+            {
+                return impl::CTsc::ToNanoseconds(BucketUpperBound(i));
+            }
+        }
+        return impl::CTsc::ToNanoseconds(BucketUpperBound(s_uBucketCount - 1));
+    };
+    summary.m_uP50 = percentile(500);
+    summary.m_uP90 = percentile(900);
+    summary.m_uP99 = percentile(990);
+    summary.m_uP999 = percentile(999);
+    summary.m_uMax = impl::CTsc::ToNanoseconds(histogram.m_uMax.load(std::memory_order_relaxed));
+    return summary;
+}
+
+[[maybe_unused]] void CFailureLatency::Reset() noexcept
+{
+    for (auto& levelHistograms : s_arrHistograms)
+    {
+        for (auto& histogram : levelHistograms)
+        {
+            for (auto& bucket : histogram.m_arrBuckets)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            histogram.m_uMax.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void CFailureLatency::Record(const EAssertLevel level, const EFailurePhase phase, const std::uint64_t ticks) noexcept
+{
+    auto& histogram = Histogram(level, phase);
+    histogram.m_arrBuckets[BucketIndex(ticks)].fetch_add(1, std::memory_order_relaxed);
+    auto max = histogram.m_uMax.load(std::memory_order_relaxed);
+    while (max < ticks && ! histogram.m_uMax.compare_exchange_weak(max, ticks, std::memory_order_relaxed))
+    {
+    }
+}
+
+} // namespace dbgh
@@ -0,0 +1,193 @@
+/**
+ * @file        CFailureLatency.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CFailureLatency class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CAssertConfig.h"
+#include "CTsc.h"
+
+namespace dbgh
+{
+
+/**
+ * @enum       EFailurePhase
+ * @brief      The measured phases of the assertion failure handling.
+ */
+enum class EFailurePhase : size_t
+{
+    /**
+     * @brief   Building the assertion information.
+     */
+    Format,
+
+    /**
+     * @brief   The call of the executor hook (HandleWarning, HandleError), including the output.
+     */
+    Executor,
+
+    /**
+     * @brief   The output of the default \ref dbgh::CHandlerExecutor::Logs.
+     */
+    Output,
+
+    /**
+     * @internal
+     * @breaf   An enumeration value that indicates the end of the enumeration.
+     */
+    END_ENUM_
+};
+
+
+/**
+ * @struct     SLatencySummary
+ * @brief      The summary of one latency histogram, the values are in nanoseconds.
+ *
+ * @details    The percentiles are the upper bounds of the histogram buckets, the relative error is below 12.5%.
+ */
+struct SLatencySummary
+{
+    std::uint64_t m_uCount;
+    std::uint64_t m_uP50;
+    std::uint64_t m_uP90;
+    std::uint64_t m_uP99;
+    std::uint64_t m_uP999;
+    std::uint64_t m_uMax;
+};
+
+
+/**
+ * @class      CFailureLatency
+ * @brief      The latency histograms of the failure path per assert level and per phase.
+ *
+ * @details    Every handled assertion failure records the duration of its phases, measured by the time stamp
+ *              counter, into lock-free log-linear histograms (16 linear buckets, then 8 buckets per power of two).
+ *              The passed assertions are not measured. The histograms are read by \ref GetSummary at any time.
+ *
+ * @example    const auto summary = dbgh::CFailureLatency::GetSummary(dbgh::EAssertLevel::Warning, dbgh::EFailurePhase::Executor);
+ *             ASSERT_WARNING(summary.m_uP99 < 50'000, "The p99 stall of warnings is {} ns.", summary.m_uP99);
+ */
+class CFailureLatency
+{
+public:
+
+    /**
+     * @brief      The count of buckets in one histogram.
+     */
+    static constexpr std::size_t s_uBucketCount = 496;
+
+    CFailureLatency() = delete;
+
+    ~CFailureLatency() = delete;
+
+    CFailureLatency(CFailureLatency&&) noexcept = delete;
+
+    CFailureLatency(const CFailureLatency&) = delete;
+
+    CFailureLatency& operator=(CFailureLatency&&) = delete;
+
+    CFailureLatency& operator=(const CFailureLatency&) = delete;
+
+    /**
+     * @brief      Gets the summary of the histogram of a given level and phase.
+     *
+     * @param[in]  level  The assert level.
+     * @param[in]  phase  The phase of the failure handling.
+     *
+     * @return     The summary in nanoseconds.
+     */
+    [[nodiscard]] static SLatencySummary GetSummary(EAssertLevel level, EFailurePhase phase) noexcept;
+
+    /**
+     * @brief      Clears all histograms.
+     */
+    [[maybe_unused]] static void Reset() noexcept;
+
+    /**
+     * @internal
+     * @brief      Records the duration into the histogram.
+     *
+     * @param[in]  level  The assert level.
+     * @param[in]  phase  The phase of the failure handling.
+     * @param[in]  ticks  The duration in ticks of \ref impl::CTsc.
+     */
+    static void Record(EAssertLevel level, EFailurePhase phase, std::uint64_t ticks) noexcept;
+};
+
+
+namespace impl
+{
+
+/**
+ * @internal
+ * @class      CLatencyScope
+ * @brief      Records the duration of the scope into \ref dbgh::CFailureLatency.
+ *
+ * @details    The scope of the executor phase also marks the level of the failure handled by the current thread,
+ *              the nested output scopes use it. The scope with the level END_ENUM_ records nothing.
+ */
+class CLatencyScope
+{
+public:
+    CLatencyScope(const EAssertLevel level, const EFailurePhase phase) noexcept
+            : m_eLevel { level }
+            , m_ePhase { phase }
+            , m_ePreviousLevel { s_eCurrentLevel }
+            , m_uStart { CTsc::Now() }
+    {
+        if (EFailurePhase::Executor == phase)
+        {
+            s_eCurrentLevel = level;
+        }
+    }
+
+    ~CLatencyScope()
+    {
+        s_eCurrentLevel = m_ePreviousLevel;
+        if (EAssertLevel::END_ENUM_ != m_eLevel)
+        {
+            CFailureLatency::Record(m_eLevel, m_ePhase, CTsc::Now() - m_uStart);
+        }
+    }
+
+    CLatencyScope(CLatencyScope&&) noexcept = delete;
+
+    CLatencyScope(const CLatencyScope&) = delete;
+
+    CLatencyScope& operator=(CLatencyScope&&) noexcept = delete;
+
+    CLatencyScope& operator=(const CLatencyScope&) = delete;
+
+    /**
+     * @brief      Gets the level of the failure handled by the current thread.
+     *
+     * @return     The level, or END_ENUM_ outside of the executor call.
+     */
+    [[nodiscard]] static EAssertLevel CurrentLevel() noexcept
+    {
+        return s_eCurrentLevel;
+    }
+
+private:
+    const EAssertLevel m_eLevel;
+    const EFailurePhase m_ePhase;
+    const EAssertLevel m_ePreviousLevel;
+    const std::uint64_t m_uStart;
+
+    /**
+     * @internal
+     * @brief      The level of the failure handled by the current thread.
+     */
+    static constinit inline thread_local EAssertLevel s_eCurrentLevel { EAssertLevel::END_ENUM_ };
+};
+
+} // namespace impl
+
+} // namespace dbgh
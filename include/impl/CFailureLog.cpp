@@ -0,0 +1,120 @@
+/**
+ * @file        CFailureLog.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CFailureLog class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#include "CExpressionText.h"
+#include "CFailureLog.h"
+#include "CSafeWriter.h"
+
+namespace dbgh::impl
+{
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      One record of the ring.
+ *
+ * @details    The sequence is odd while the record is written and 2 * (position + 1) after that.
+ */
+struct SFailureRecord
+{
+    std::atomic<std::uint64_t> m_uSequence;
+    EAssertLevel m_eLevel;
+    const char* m_strExpression;
+    const char* m_strFile;
+    TLine m_iLine;
+    const char* m_strFunction;
+    std::size_t m_uMessageSize;
+    char m_arrMessage[CFailureLog::s_uMessageSize];
+};
+
+constinit SFailureRecord s_arrRecords[CFailureLog::s_uRecordCount] { };
+
+/**
+ * @internal
+ * @brief      The position of the next record.
+ */
+constinit std::atomic<std::uint64_t> s_uNext { 0 };
+
+[[nodiscard]] const char* ToString(const EAssertLevel level) noexcept
+{
+    constexpr const char* arrNames[] { "WARNING", "DEBUG", "ERROR", "FATAL", "AUDIT" };
+    const auto index = static_cast<std::size_t>(level);
+    return index < std::size(arrNames) ? arrNames[index] : "UNKNOWN";
+}
+
+}  // unnamed namespace
+
+void CFailureLog::Record(
+        const EAssertLevel level, const std::string_view message, const char* expression, const char* file,
+        const TLine line, const char* function) noexcept
+{
+    const auto position = s_uNext.fetch_add(1, std::memory_order_relaxed);
+    auto& record = s_arrRecords[position % s_uRecordCount];
+
+    record.m_uSequence.store(2 * position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    record.m_eLevel = level;
+    record.m_strExpression = expression;
+    record.m_strFile = file;
+    record.m_iLine = line;
+    record.m_strFunction = function;
+    record.m_uMessageSize = std::min(message.size(), s_uMessageSize);
+    std::copy_n(message.data(), record.m_uMessageSize, record.m_arrMessage);
+    record.m_uSequence.store(2 * position + 2, std::memory_order_release);
+}
+
+void CFailureLog::Dump(CSafeWriter& writer, const char* prefix) noexcept
+{
+    const auto next = s_uNext.load(std::memory_order_acquire);
+    const auto first = next > s_uRecordCount ? next - s_uRecordCount : 0;
+    for (auto position = first; position < next; ++position)
+    {
+        const auto& record = s_arrRecords[position % s_uRecordCount];
+        const auto sequence = 2 * position + 2;
+        if (sequence != record.m_uSequence.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        // The ring can wrap while the record is read, the copy is used only if the record is not rewritten.
+        const auto level = record.m_eLevel;
+        const auto* expression = record.m_strExpression;
+        const auto* file = record.m_strFile;
+        const auto line = record.m_iLine;
+        const auto* function = record.m_strFunction;
+        const auto messageSize = std::min(record.m_uMessageSize, s_uMessageSize);
+        char arrMessage[s_uMessageSize];
+        std::copy_n(record.m_arrMessage, messageSize, arrMessage);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence != record.m_uSequence.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        char arrExpression[256];
+        const auto* text = CExpressionText::IsCompressed(expression)
+                           ? CExpressionText::Decode(expression, arrExpression, sizeof(arrExpression))
+                           : expression;
+        writer.Write(prefix).Write("#").WriteUnsigned(position).Write(" ").Write(ToString(level))
+              .Write(" ").Write(file).Write(":").WriteSigned(line)
+              .Write(" ").Write(function).Write(": ").Write(text)
+              .Write(" - ").Write(std::string_view { arrMessage, messageSize }).Write("\n");
+    }
+}
+
+std::uint64_t CFailureLog::GetCount() noexcept
+{
+    return s_uNext.load(std::memory_order_relaxed);
+}
+
+} // namespace dbgh::impl
@@ -0,0 +1,87 @@
+/**
+ * @file        CFailureLog.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CFailureLog class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "CAssertConfig.h"
+
+namespace dbgh::impl
+{
+
+class CSafeWriter;
+
+/**
+ * @internal
+ * @class      CFailureLog
+ * @brief      The fixed-size ring of the last assertion failures of the process.
+ *
+ * @details    Every failed assertion is recorded before it is handled. The records are preallocated, the message
+ *              is truncated to \ref s_uMessageSize characters. The ring is written without locks and can be dumped
+ *              from the signal handler, the records which are being written at that moment are skipped.
+ */
+class CFailureLog
+{
+public:
+
+    /**
+     * @brief      The count of the stored records.
+     */
+    static constexpr std::size_t s_uRecordCount = 16;
+
+    /**
+     * @brief      The maximal stored size of the message.
+     */
+    static constexpr std::size_t s_uMessageSize = 96;
+
+    CFailureLog() = delete;
+
+    ~CFailureLog() = delete;
+
+    CFailureLog(CFailureLog&&) noexcept = delete;
+
+    CFailureLog(const CFailureLog&) = delete;
+
+    CFailureLog& operator=(CFailureLog&&) = delete;
+
+    CFailureLog& operator=(const CFailureLog&) = delete;
+
+    /**
+     * @brief      Records the failure, the oldest record is overwritten.
+     *
+     * @param[in]  level       The assert level.
+     * @param[in]  message     The error description.
+     * @param[in]  expression  Expression of the assertion, as a string with static storage duration.
+     * @param[in]  file        The filename, as a string with static storage duration.
+     * @param[in]  line        The line number.
+     * @param[in]  function    The function name, as a string with static storage duration.
+     */
+    static void Record(
+            EAssertLevel level, std::string_view message, const char* expression, const char* file, TLine line,
+            const char* function) noexcept;
+
+    /**
+     * @brief      Writes the stored records from the oldest, async-signal-safe.
+     *
+     * @param[in]  writer  The async-signal-safe writer.
+     * @param[in]  prefix  The prefix of each line.
+     */
+    static void Dump(CSafeWriter& writer, const char* prefix) noexcept;
+
+    /**
+     * @brief      Gets the count of the recorded failures since the start of the process.
+     *
+     * @return     The count of failures.
+     */
+    [[nodiscard]] static std::uint64_t GetCount() noexcept;
+};
+
+} // namespace dbgh::impl
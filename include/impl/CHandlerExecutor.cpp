@@ -7,11 +7,24 @@
  */
 
 
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
 #include <iostream>
+#include <string>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <poll.h>
+#include <unistd.h>
+#endif
 
 #include "CHandlerExecutor.h"
 
 #include "CAssertConfig.h"
+#include "CFailureLatency.h"
 
 namespace dbgh
 {
@@ -27,14 +40,24 @@ void CHandlerExecutor::HandleWarning(std::string_view message)
     Logs(message);
 }
 
-void CHandlerExecutor::HandleError(std::string_view message, const CAssertException& exception)
+void CHandlerExecutor::HandleError(std::string_view message, [[maybe_unused]] const CAssertException& exception)
 {
     Logs(message);
+#ifdef DBGH_ASSERTS_EXCEPTIONS
     throw exception;
+#else
+    std::terminate();
+#endif
+}
+
+void CHandlerExecutor::HandleVerify(std::string_view message)
+{
+    Logs(message);
 }
 
 void CHandlerExecutor::Logs(std::string_view message)
 {
+    const impl::CLatencyScope latency { impl::CLatencyScope::CurrentLevel(), EFailurePhase::Output };
     std::cerr << message << std::endl;
 }
 
@@ -45,9 +68,66 @@ void CHandlerExecutor::ShowMessage(std::string_view message)
 
 char CHandlerExecutor::GetUserInput()
 {
-    char ch = 0;
-    std::cin >> ch;
-    return ch;
+    // The whole line is consumed, so the rest of the answer does not satisfy the next wait.
+    std::string line;
+#ifdef _WIN32
+    if (! std::getline(std::cin, line) && line.empty())
+    {
+        return s_cNoInput;
+    }
+#else
+    // The line is read from the descriptor byte by byte: std::getline over the buffered stdin reads ahead
+    // of the line, and the next answer would be hidden from poll() in WaitForUserInput.
+    for (char ch = 0;;)
+    {
+        const auto size = read(STDIN_FILENO, &ch, 1);
+        if (1 == size)
+        {
+            if ('\n' == ch)
+            {
+                break;
+            }
+            line.push_back(ch);
+        }
+        else if (size < 0 && EINTR == errno)
+        {
+            continue;
+        }
+        else if (line.empty())
+        {
+            // The end of the input or the read error, the closed input stays readable for poll().
+            return s_cNoInput;
+        }
+        else
+        {
+            break;
+        }
+    }
+#endif
+    const auto first = std::find_if(std::begin(line), std::end(line), [](const char c)
+    {
+        return 0 == std::isspace(static_cast<unsigned char>(c));
+    });
+    return std::end(line) == first ? '\n' : *first;
+}
+
+bool CHandlerExecutor::IsInteractive()
+{
+#ifdef _WIN32
+    return 0 != _isatty(_fileno(stdin));
+#else
+    return 0 != isatty(STDIN_FILENO);
+#endif
+}
+
+bool CHandlerExecutor::WaitForUserInput(const std::chrono::milliseconds timeout)
+{
+#ifdef _WIN32
+    return WAIT_OBJECT_0 == WaitForSingleObject(GetStdHandle(STD_INPUT_HANDLE), static_cast<DWORD>(timeout.count()));
+#else
+    pollfd descriptor { STDIN_FILENO, POLLIN, 0 };
+    return poll(&descriptor, 1, static_cast<int>(timeout.count())) > 0;
+#endif
 }
 
 void CHandlerExecutor::DebugPreCall()
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <string_view>
 
 #include "CAssertException.h"
@@ -92,6 +93,9 @@ public:
      * @brief      The handler for error assert.
      *
      * @details    By default writes the message using \ref CHandlerExecutor::Logs and throw the given exception.
+     *              Without the exceptions (DBGH_ASSERTS_EXCEPTIONS is not defined) by default writes the message
+     *              and calls std::terminate, the override may also return to continue the execution after the
+     *              failed assertion.
      *
      * @note       To change or add new behavior, defined the new class inherits from
      *              \ref dbgh::CHandlerExecutor and override this method, and set in dbgh::CAssertConfig.
@@ -108,7 +112,24 @@ public:
      *
      * @param[in]  message  The message for logging.
      */
-    [[noreturn]] virtual void HandleError(std::string_view message, const CAssertException &exception);
+#ifdef DBGH_ASSERTS_EXCEPTIONS
+    [[noreturn]]
+#endif
+    virtual void HandleError(std::string_view message, const CAssertException &exception);
+
+    /**
+     * @brief      The handler for the failed verification (\ref DBGH_VERIFY).
+     *
+     * @details    By default writes the message using \ref CHandlerExecutor::Logs. The failure is returned to
+     *              the caller as a value, the handler must not throw.
+     *
+     * @note       To change or add new behavior, defined the new class inherits from
+     *              \ref dbgh::CHandlerExecutor and override this method, and set in dbgh::CAssertConfig.
+     *             For example, possible to count the rejected requests.
+     *
+     * @param[in]  message  The message for logging.
+     */
+    virtual void HandleVerify(std::string_view message);
 
     /**
      * @brief      The Logs method defines a method for logging information about violated assertions.
@@ -150,10 +171,17 @@ public:
      */
     virtual void ShowMessage(std::string_view message);
 
+    /**
+     * @brief      The result of \ref GetUserInput if the input is closed or can not be read.
+     */
+    static constexpr char s_cNoInput = '\0';
+
     /**
      * @brief      Gets the user input.
      *
-     * @details    By default read the specified char value, using the standard input (std::cin).
+     * @details    By default reads one line from the standard input and returns its first non-space character,
+     *              the rest of the line is discarded. An empty line is returned as '\n'. If the input is closed
+     *              or can not be read, returns \ref s_cNoInput and the headless action is applied.
      *
      * @note       To change, defined the new class inherits from \ref dbgh::CHandlerExecutor and override
      *              this method, and set in dbgh::CAssertConfig.
@@ -163,6 +191,35 @@ public:
      */
     virtual char GetUserInput();
 
+    /**
+     * @brief      Checks if the user can be asked for the action of \ref ASSERT_DEBUG.
+     *
+     * @details    By default, returns true if the standard input is a terminal. If the executor is not interactive,
+     *              the failed ASSERT_DEBUG is logged and the headless action from \ref dbgh::CAssertConfig is applied.
+     *
+     * @note       To change, defined the new class inherits from \ref dbgh::CHandlerExecutor and override
+     *              this method, and set in dbgh::CAssertConfig.
+     *             For example, the GUI application is interactive without a terminal.
+     *
+     * @return     True if the user can be asked, False otherwise.
+     */
+    virtual bool IsInteractive();
+
+    /**
+     * @brief      Waits until the user input is available.
+     *
+     * @details    By default waits for the standard input. Called before \ref GetUserInput only if the prompt
+     *              timeout is set in \ref dbgh::CAssertConfig.
+     *
+     * @note       To change, defined the new class inherits from \ref dbgh::CHandlerExecutor and override
+     *              this method together with GetUserInput, and set in dbgh::CAssertConfig.
+     *
+     * @param[in]  timeout  The maximal time of waiting.
+     *
+     * @return     True if the input is available, False if the time is out.
+     */
+    virtual bool WaitForUserInput(std::chrono::milliseconds timeout);
+
     /**
      * @brief      The pre handle for ASSERT_DEBUG.
      *
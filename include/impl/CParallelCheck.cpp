@@ -0,0 +1,212 @@
+/**
+ * @file        CParallelCheck.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CParallelCheck class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CParallelCheck.h"
+#include "CAssertConfig.h"
+
+namespace dbgh::impl
+{
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      The minimal count of elements in one chunk, the smaller ranges are checked on the calling thread.
+ */
+constexpr std::size_t s_uMinChunkSize = 16 * 1024;
+
+/**
+ * @internal
+ * @brief      The count of chunks per thread, more chunks give better balancing for uneven predicates.
+ */
+constexpr std::size_t s_uChunksPerThread = 16;
+
+/**
+ * @internal
+ * @brief      Gets the configured count of threads which take part in a parallel check.
+ */
+std::size_t ThreadCount() noexcept
+{
+    const auto count = CAssertConfig::Get().GetParallelCheckThreads();
+    if (0 != count)
+    {
+        return count;
+    }
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * @internal
+ * @class      CCheckThreadPool
+ * @brief      The persistent workers for the parallel checks, created on the first parallel check.
+ */
+class CCheckThreadPool
+{
+public:
+
+    using TChunkTask = void (*)(void* context, std::size_t chunk);
+
+    CCheckThreadPool() = default;
+
+    ~CCheckThreadPool()
+    {
+        stopWorkers();
+    }
+
+    CCheckThreadPool(CCheckThreadPool&&) noexcept = delete;
+
+    CCheckThreadPool(const CCheckThreadPool&) = delete;
+
+    CCheckThreadPool& operator=(CCheckThreadPool&&) = delete;
+
+    CCheckThreadPool& operator=(const CCheckThreadPool&) = delete;
+
+    static CCheckThreadPool& Get()
+    {
+        static CCheckThreadPool uniqueInstance;
+        return uniqueInstance;
+    }
+
+    /**
+     * @brief      Runs the task for all chunks, returns false if the pool is busy with another check.
+     */
+    bool TryRun(const std::size_t chunkCount, const TChunkTask task, void* context)
+    {
+        std::unique_lock ownerLock { m_mtxOwner, std::try_to_lock };
+        if (! ownerLock.owns_lock())
+        {
+            return false;
+        }
+
+        const auto workerCount = ThreadCount() - 1;
+        if (workerCount != m_vecWorkers.size())
+        {
+            stopWorkers();
+            startWorkers(workerCount);
+        }
+
+        {
+            std::lock_guard lock { m_mtxState };
+            m_fnTask = task;
+            m_pContext = context;
+            m_uChunkCount = chunkCount;
+            m_uNextChunk.store(0, std::memory_order_relaxed);
+            m_uActiveWorkers = m_vecWorkers.size();
+            ++m_uGeneration;
+        }
+        m_cvStart.notify_all();
+
+        processChunks();
+
+        std::unique_lock lock { m_mtxState };
+        m_cvDone.wait(lock, [this] { return 0 == m_uActiveWorkers; });
+        return true;
+    }
+
+private:
+
+    void startWorkers(const std::size_t count)
+    {
+        m_bStop = false;
+        m_vecWorkers.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            m_vecWorkers.emplace_back([this, generation = m_uGeneration] { workerLoop(generation); });
+        }
+    }
+
+    void stopWorkers()
+    {
+        {
+            std::lock_guard lock { m_mtxState };
+            m_bStop = true;
+        }
+        m_cvStart.notify_all();
+        for (auto& worker : m_vecWorkers)
+        {
+            worker.join();
+        }
+        m_vecWorkers.clear();
+    }
+
+    void workerLoop(std::uint64_t generation)
+    {
+        for (;;)
+        {
+            {
+                std::unique_lock lock { m_mtxState };
+                m_cvStart.wait(lock, [this, generation] { return m_bStop || generation != m_uGeneration; });
+                if (m_bStop)
+                {
+                    return;
+                }
+                generation = m_uGeneration;
+            }
+
+            processChunks();
+
+            {
+                std::lock_guard lock { m_mtxState };
+                --m_uActiveWorkers;
+            }
+            m_cvDone.notify_one();
+        }
+    }
+
+    void processChunks()
+    {
+        for (auto chunk = m_uNextChunk.fetch_add(1, std::memory_order_relaxed); chunk < m_uChunkCount
+             ; chunk = m_uNextChunk.fetch_add(1, std::memory_order_relaxed))
+        {
+            m_fnTask(m_pContext, chunk);
+        }
+    }
+
+    std::mutex m_mtxOwner;
+    std::mutex m_mtxState;
+    std::condition_variable m_cvStart;
+    std::condition_variable m_cvDone;
+    std::vector<std::thread> m_vecWorkers;
+    std::uint64_t m_uGeneration { 0 };
+    std::size_t m_uActiveWorkers { 0 };
+    bool m_bStop { false };
+
+    TChunkTask m_fnTask { nullptr };
+    void* m_pContext { nullptr };
+    std::size_t m_uChunkCount { 0 };
+    std::atomic<std::size_t> m_uNextChunk { 0 };
+};
+
+}  // unnamed namespace
+
+std::size_t CParallelCheck::chunkSize(const std::size_t size) noexcept
+{
+    const auto chunkCount = ThreadCount() * s_uChunksPerThread;
+    return std::max(s_uMinChunkSize, (size + chunkCount - 1) / chunkCount);
+}
+
+void CParallelCheck::run(const std::size_t chunkCount, const TChunkTask task, void* context)
+{
+    if (chunkCount > 1 && ThreadCount() > 1 && CCheckThreadPool::Get().TryRun(chunkCount, task, context))
+    {
+        return;
+    }
+    for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        task(context, chunk);
+    }
+}
+
+} // namespace dbgh::impl
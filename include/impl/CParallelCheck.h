@@ -0,0 +1,152 @@
+/**
+ * @file        CParallelCheck.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CParallelCheck class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CParallelCheck
+ * @brief      Checks a predicate over a large random access range on the thread pool of the library.
+ *
+ * @details    The range is split into chunks which are taken by the workers in increasing order. When a worker
+ *              finds a failing element it lowers the shared failing index, all workers stop scanning the chunks
+ *              after that index. The chunks before it are always scanned completely, so the smallest failing
+ *              index is reported independently of the scheduling.
+ *              The size of the thread pool is configured by \ref dbgh::CAssertConfig::SetParallelCheckThreads.
+ */
+class CParallelCheck
+{
+public:
+
+    /**
+     * @brief      The value returned if there is no failing element.
+     */
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    CParallelCheck() = delete;
+
+    ~CParallelCheck() = delete;
+
+    CParallelCheck(CParallelCheck&&) noexcept = delete;
+
+    CParallelCheck(const CParallelCheck&) = delete;
+
+    CParallelCheck& operator=(CParallelCheck&&) = delete;
+
+    CParallelCheck& operator=(const CParallelCheck&) = delete;
+
+    /**
+     * @brief      Finds the first element of the range which does not satisfy the predicate.
+     *
+     * @note       The predicate is called concurrently from several threads, it must be thread safe and must not throw.
+     *
+     * @param[in]  range      The random access range.
+     * @param[in]  predicate  The predicate with signature bool(const T&).
+     *
+     * @return     The smallest index of the failing element, or \ref npos.
+     */
+    template <typename TRange, typename TPredicate>
+    [[nodiscard]] static std::size_t FindFirstFailure(const TRange& range, const TPredicate& predicate)
+    {
+        static_assert(std::ranges::random_access_range<const TRange>
+                      , "ASSERT_ALL_OF_PAR requires a random access range.");
+
+        const auto size = static_cast<std::size_t>(std::ranges::size(range));
+        SContext<std::ranges::iterator_t<const TRange>, TPredicate> context {
+                std::ranges::begin(range), predicate, size, chunkSize(size), { npos } };
+        run((size + context.m_uChunkSize - 1) / context.m_uChunkSize, &checkChunk<decltype(context)>, &context);
+        return context.m_uFirstFailure.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      The signature of the type-erased chunk task.
+     */
+    using TChunkTask = void (*)(void* context, std::size_t chunk);
+
+    /**
+     * @internal
+     * @brief      The state of one parallel check shared by all workers.
+     */
+    template <typename TIterator, typename TPredicate>
+    struct SContext
+    {
+        TIterator m_itFirst;
+        const TPredicate& m_predicate;
+        std::size_t m_uSize;
+        std::size_t m_uChunkSize;
+        std::atomic<std::size_t> m_uFirstFailure;
+    };
+
+    /**
+     * @internal
+     * @brief      The count of elements checked between two reads of the shared failing index.
+     */
+    static constexpr std::size_t s_uStopCheckInterval = 1024;
+
+    /**
+     * @internal
+     * @brief      Scans one chunk of the range.
+     */
+    template <typename TContext>
+    static void checkChunk(void* pContext, const std::size_t chunk)
+    {
+        auto& context = *static_cast<TContext*>(pContext);
+        const auto begin = chunk * context.m_uChunkSize;
+        const auto end = std::min(begin + context.m_uChunkSize, context.m_uSize);
+
+        for (auto blockBegin = begin; blockBegin < end; blockBegin += s_uStopCheckInterval)
+        {
+            if (context.m_uFirstFailure.load(std::memory_order_relaxed) < blockBegin)
+            {
+                return;
+            }
+            const auto blockEnd = std::min(blockBegin + s_uStopCheckInterval, end);
+            auto it = context.m_itFirst + static_cast<std::iter_difference_t<decltype(context.m_itFirst)>>(blockBegin);
+            for (auto i = blockBegin; i < blockEnd; ++i, ++it)
+            {
+                if (! bool(context.m_predicate(*it)))
+                {
+                    auto current = context.m_uFirstFailure.load(std::memory_order_relaxed);
+                    while (i < current && ! context.m_uFirstFailure.compare_exchange_weak(current, i))
+                    {
+                    }
+                    return;
+                }
+            }
+        }
+    }
+
+    /**
+     * @internal
+     * @brief      Gets the chunk size for the range of the given size.
+     */
+    [[nodiscard]] static std::size_t chunkSize(std::size_t size) noexcept;
+
+    /**
+     * @internal
+     * @brief      Runs the task for all chunks on the thread pool and waits for the completion.
+     *
+     * @details    The calling thread takes part in the work. If the pool is busy with another check
+     *              (for example a nested check), the chunks are processed on the calling thread only.
+     */
+    static void run(std::size_t chunkCount, TChunkTask task, void* context);
+};
+
+} // namespace dbgh::impl
@@ -0,0 +1,107 @@
+/**
+ * @file        CProbes.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CProbes class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "CAssertConfig.h"
+#include "CExpressionText.h"
+#include "DBGHSdt.h"
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CProbes
+ * @brief      The USDT probes of the assertions.
+ *
+ * @details    The probes are emitted only if the library is built with the DBGH_ASSERTS_USDT CMake option:
+ *              > dbgh:assert_failed(site_id, level, file, line, message) fires on every assertion failure.
+ *              > dbgh:assert_eval(site_id, level) fires on every evaluation of an assertion, it is emitted
+ *                at each assertion site only with the DBGH_ASSERTS_USDT_EVAL option.
+ *              The site id is the FNV-1a hash of the file name and the line, the same for both probes.
+ *
+ * @example    bpftrace -e 'usdt:./app:dbgh:assert_failed { printf("%s:%d %s\n", str(arg2), arg3, str(arg4)); }'
+ */
+class CProbes
+{
+public:
+    CProbes() = delete;
+
+    ~CProbes() = delete;
+
+    CProbes(CProbes&&) noexcept = delete;
+
+    CProbes(const CProbes&) = delete;
+
+    CProbes& operator=(CProbes&&) = delete;
+
+    CProbes& operator=(const CProbes&) = delete;
+
+    /**
+     * @brief      Gets the id of the assertion site.
+     *
+     * @param[in]  file  The filename.
+     * @param[in]  line  The line number.
+     *
+     * @return     The site id.
+     */
+    [[nodiscard]] static constexpr std::uint64_t SiteId(const char* file, const TLine line) noexcept
+    {
+        std::uint64_t hash = 0xCBF29CE484222325ULL;
+        for (; nullptr != file && '\0' != *file; ++file)
+        {
+            hash = (hash ^ static_cast<unsigned char>(*file)) * 0x100000001B3ULL;
+        }
+        return (hash ^ static_cast<std::uint32_t>(line)) * 0x100000001B3ULL;
+    }
+
+    /**
+     * @brief      Fires the dbgh:assert_eval probe.
+     *
+     * @return     Always true, the call is a part of the assertion condition.
+     */
+    template <std::uint64_t TSiteId, EAssertLevel TLevel>
+    [[gnu::always_inline]] static inline bool Evaluated() noexcept
+    {
+        DBGH_SDT_PROBE2(dbgh, assert_eval, TSiteId, static_cast<int>(TLevel));
+        return true;
+    }
+
+    /**
+     * @brief      Fires the dbgh:assert_failed probe.
+     */
+    static void Failed(
+            [[maybe_unused]] const EAssertLevel level, [[maybe_unused]] const char* file,
+            [[maybe_unused]] const TLine line, [[maybe_unused]] const char* message) noexcept
+    {
+#ifdef DBGH_ASSERTS_USDT
+        DBGH_SDT_PROBE5(dbgh, assert_failed, SiteId(file, line), static_cast<int>(level), file, line, message);
+#endif
+    }
+};
+
+} // namespace dbgh::impl
+
+
+#ifdef DBGH_ASSERTS_USDT_EVAL
+
+/**
+ * @internal
+ * @brief      The part of the assertion condition which fires the dbgh:assert_eval probe.
+ */
+#define IMPL_DBGH_PROBE_EVAL(_level_)                                                                                                   \
+    dbgh::impl::CProbes::Evaluated<dbgh::impl::CProbes::SiteId(IMPL_DBGH_FILE, __LINE__), _level_>()
+
+#else
+
+#define IMPL_DBGH_PROBE_EVAL(_level_) true
+
+#endif
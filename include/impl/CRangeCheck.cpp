@@ -0,0 +1,513 @@
+/**
+ * @file        CRangeCheck.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CRangeCheck class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <limits>
+
+#include "CRangeCheck.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define DBGH_RANGE_CHECK_X86 1
+#include <immintrin.h>
+#else
+#define DBGH_RANGE_CHECK_X86 0
+#endif
+
+#if DBGH_RANGE_CHECK_X86 && (defined(__GNUC__) || defined(__clang__))
+#define DBGH_RANGE_CHECK_AVX2 1
+#define DBGH_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define DBGH_RANGE_CHECK_AVX2 0
+#define DBGH_TARGET_AVX2
+#endif
+
+namespace dbgh::impl
+{
+
+namespace
+{
+
+using TSpanIndex = std::size_t;
+
+constexpr auto npos = CRangeCheck::npos;
+
+/**
+ * @internal
+ * @brief      The scalar kernels, used for the tails and as the fallback on the other platforms.
+ */
+namespace scalar
+{
+
+template <typename T>
+TSpanIndex FindNonFinite(const T* data, TSpanIndex size, TSpanIndex from) noexcept
+{
+    for (auto i = from; i < size; ++i)
+    {
+        if (! std::isfinite(data[i]))
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+
+template <typename T>
+TSpanIndex FindOutOfRange(const T* data, TSpanIndex size, T lo, T hi, TSpanIndex from) noexcept
+{
+    for (auto i = from; i < size; ++i)
+    {
+        if (! (lo <= data[i] && data[i] <= hi))
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+
+template <typename T>
+TSpanIndex FindUnsorted(const T* data, TSpanIndex size, TSpanIndex from) noexcept
+{
+    for (auto i = (0 == from ? 1 : from); i < size; ++i)
+    {
+        if (! (data[i - 1] <= data[i]))
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+
+inline TSpanIndex FindNull(const void* const* data, TSpanIndex size, TSpanIndex from) noexcept
+{
+    for (auto i = from; i < size; ++i)
+    {
+        if (nullptr == data[i])
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+
+} // namespace scalar
+
+#if DBGH_RANGE_CHECK_X86
+
+/**
+ * @internal
+ * @brief      The SSE2 kernels, SSE2 is the baseline of x86-64. A failing block is rescanned by the scalar kernel
+ *              to find the exact index.
+ */
+namespace sse2
+{
+
+inline TSpanIndex FindNonFinite(const float* data, TSpanIndex size) noexcept
+{
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 inf = _mm_set1_ps(std::numeric_limits<float>::infinity());
+    TSpanIndex i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128 finite = _mm_cmplt_ps(_mm_and_ps(_mm_loadu_ps(data + i), absMask), inf);
+        if (0xF != _mm_movemask_ps(finite))
+        {
+            return scalar::FindNonFinite(data, i + 4, i);
+        }
+    }
+    return scalar::FindNonFinite(data, size, i);
+}
+
+inline TSpanIndex FindNonFinite(const double* data, TSpanIndex size) noexcept
+{
+    const __m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffff));
+    const __m128d inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    TSpanIndex i = 0;
+    for (; i + 2 <= size; i += 2)
+    {
+        const __m128d finite = _mm_cmplt_pd(_mm_and_pd(_mm_loadu_pd(data + i), absMask), inf);
+        if (0x3 != _mm_movemask_pd(finite))
+        {
+            return scalar::FindNonFinite(data, i + 2, i);
+        }
+    }
+    return scalar::FindNonFinite(data, size, i);
+}
+
+inline TSpanIndex FindOutOfRange(const float* data, TSpanIndex size, float lo, float hi) noexcept
+{
+    const __m128 vLo = _mm_set1_ps(lo);
+    const __m128 vHi = _mm_set1_ps(hi);
+    TSpanIndex i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128 value = _mm_loadu_ps(data + i);
+        const __m128 inRange = _mm_and_ps(_mm_cmple_ps(vLo, value), _mm_cmple_ps(value, vHi));
+        if (0xF != _mm_movemask_ps(inRange))
+        {
+            return scalar::FindOutOfRange(data, i + 4, lo, hi, i);
+        }
+    }
+    return scalar::FindOutOfRange(data, size, lo, hi, i);
+}
+
+inline TSpanIndex FindOutOfRange(const double* data, TSpanIndex size, double lo, double hi) noexcept
+{
+    const __m128d vLo = _mm_set1_pd(lo);
+    const __m128d vHi = _mm_set1_pd(hi);
+    TSpanIndex i = 0;
+    for (; i + 2 <= size; i += 2)
+    {
+        const __m128d value = _mm_loadu_pd(data + i);
+        const __m128d inRange = _mm_and_pd(_mm_cmple_pd(vLo, value), _mm_cmple_pd(value, vHi));
+        if (0x3 != _mm_movemask_pd(inRange))
+        {
+            return scalar::FindOutOfRange(data, i + 2, lo, hi, i);
+        }
+    }
+    return scalar::FindOutOfRange(data, size, lo, hi, i);
+}
+
+inline TSpanIndex FindOutOfRange(const std::int32_t* data, TSpanIndex size, std::int32_t lo, std::int32_t hi) noexcept
+{
+    const __m128i vLo = _mm_set1_epi32(lo);
+    const __m128i vHi = _mm_set1_epi32(hi);
+    TSpanIndex i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i outOfRange = _mm_or_si128(_mm_cmpgt_epi32(vLo, value), _mm_cmpgt_epi32(value, vHi));
+        if (0 != _mm_movemask_epi8(outOfRange))
+        {
+            return scalar::FindOutOfRange(data, i + 4, lo, hi, i);
+        }
+    }
+    return scalar::FindOutOfRange(data, size, lo, hi, i);
+}
+
+inline TSpanIndex FindUnsorted(const float* data, TSpanIndex size) noexcept
+{
+    TSpanIndex i = 1;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128 ordered = _mm_cmple_ps(_mm_loadu_ps(data + i - 1), _mm_loadu_ps(data + i));
+        if (0xF != _mm_movemask_ps(ordered))
+        {
+            return scalar::FindUnsorted(data, i + 4, i);
+        }
+    }
+    return scalar::FindUnsorted(data, size, i);
+}
+
+inline TSpanIndex FindUnsorted(const double* data, TSpanIndex size) noexcept
+{
+    TSpanIndex i = 1;
+    for (; i + 2 <= size; i += 2)
+    {
+        const __m128d ordered = _mm_cmple_pd(_mm_loadu_pd(data + i - 1), _mm_loadu_pd(data + i));
+        if (0x3 != _mm_movemask_pd(ordered))
+        {
+            return scalar::FindUnsorted(data, i + 2, i);
+        }
+    }
+    return scalar::FindUnsorted(data, size, i);
+}
+
+inline TSpanIndex FindUnsorted(const std::int32_t* data, TSpanIndex size) noexcept
+{
+    TSpanIndex i = 1;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i - 1));
+        const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (0 != _mm_movemask_epi8(_mm_cmpgt_epi32(previous, current)))
+        {
+            return scalar::FindUnsorted(data, i + 4, i);
+        }
+    }
+    return scalar::FindUnsorted(data, size, i);
+}
+
+} // namespace sse2
+
+#endif // DBGH_RANGE_CHECK_X86
+
+#if DBGH_RANGE_CHECK_AVX2
+
+/**
+ * @internal
+ * @brief      The AVX2 kernels, used only if the CPU supports AVX2.
+ */
+namespace avx2
+{
+
+DBGH_TARGET_AVX2 TSpanIndex FindNonFinite(const float* data, TSpanIndex size) noexcept
+{
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+    TSpanIndex i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 finite = _mm256_cmp_ps(_mm256_and_ps(_mm256_loadu_ps(data + i), absMask), inf, _CMP_LT_OQ);
+        if (0xFF != _mm256_movemask_ps(finite))
+        {
+            return scalar::FindNonFinite(data, i + 8, i);
+        }
+    }
+    return scalar::FindNonFinite(data, size, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindNonFinite(const double* data, TSpanIndex size) noexcept
+{
+    const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffff));
+    const __m256d inf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    TSpanIndex i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256d finite = _mm256_cmp_pd(_mm256_and_pd(_mm256_loadu_pd(data + i), absMask), inf, _CMP_LT_OQ);
+        if (0xF != _mm256_movemask_pd(finite))
+        {
+            return scalar::FindNonFinite(data, i + 4, i);
+        }
+    }
+    return scalar::FindNonFinite(data, size, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindOutOfRange(const float* data, TSpanIndex size, float lo, float hi) noexcept
+{
+    const __m256 vLo = _mm256_set1_ps(lo);
+    const __m256 vHi = _mm256_set1_ps(hi);
+    TSpanIndex i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 value = _mm256_loadu_ps(data + i);
+        const __m256 inRange = _mm256_and_ps(_mm256_cmp_ps(vLo, value, _CMP_LE_OQ), _mm256_cmp_ps(value, vHi, _CMP_LE_OQ));
+        if (0xFF != _mm256_movemask_ps(inRange))
+        {
+            return scalar::FindOutOfRange(data, i + 8, lo, hi, i);
+        }
+    }
+    return scalar::FindOutOfRange(data, size, lo, hi, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindOutOfRange(const double* data, TSpanIndex size, double lo, double hi) noexcept
+{
+    const __m256d vLo = _mm256_set1_pd(lo);
+    const __m256d vHi = _mm256_set1_pd(hi);
+    TSpanIndex i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256d value = _mm256_loadu_pd(data + i);
+        const __m256d inRange = _mm256_and_pd(_mm256_cmp_pd(vLo, value, _CMP_LE_OQ), _mm256_cmp_pd(value, vHi, _CMP_LE_OQ));
+        if (0xF != _mm256_movemask_pd(inRange))
+        {
+            return scalar::FindOutOfRange(data, i + 4, lo, hi, i);
+        }
+    }
+    return scalar::FindOutOfRange(data, size, lo, hi, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindOutOfRange(
+        const std::int32_t* data, TSpanIndex size, std::int32_t lo, std::int32_t hi) noexcept
+{
+    const __m256i vLo = _mm256_set1_epi32(lo);
+    const __m256i vHi = _mm256_set1_epi32(hi);
+    TSpanIndex i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i outOfRange = _mm256_or_si256(_mm256_cmpgt_epi32(vLo, value), _mm256_cmpgt_epi32(value, vHi));
+        if (0 != _mm256_movemask_epi8(outOfRange))
+        {
+            return scalar::FindOutOfRange(data, i + 8, lo, hi, i);
+        }
+    }
+    return scalar::FindOutOfRange(data, size, lo, hi, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindOutOfRange(
+        const std::int64_t* data, TSpanIndex size, std::int64_t lo, std::int64_t hi) noexcept
+{
+    const __m256i vLo = _mm256_set1_epi64x(lo);
+    const __m256i vHi = _mm256_set1_epi64x(hi);
+    TSpanIndex i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i outOfRange = _mm256_or_si256(_mm256_cmpgt_epi64(vLo, value), _mm256_cmpgt_epi64(value, vHi));
+        if (0 != _mm256_movemask_epi8(outOfRange))
+        {
+            return scalar::FindOutOfRange(data, i + 4, lo, hi, i);
+        }
+    }
+    return scalar::FindOutOfRange(data, size, lo, hi, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindUnsorted(const float* data, TSpanIndex size) noexcept
+{
+    TSpanIndex i = 1;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 ordered = _mm256_cmp_ps(_mm256_loadu_ps(data + i - 1), _mm256_loadu_ps(data + i), _CMP_LE_OQ);
+        if (0xFF != _mm256_movemask_ps(ordered))
+        {
+            return scalar::FindUnsorted(data, i + 8, i);
+        }
+    }
+    return scalar::FindUnsorted(data, size, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindUnsorted(const double* data, TSpanIndex size) noexcept
+{
+    TSpanIndex i = 1;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256d ordered = _mm256_cmp_pd(_mm256_loadu_pd(data + i - 1), _mm256_loadu_pd(data + i), _CMP_LE_OQ);
+        if (0xF != _mm256_movemask_pd(ordered))
+        {
+            return scalar::FindUnsorted(data, i + 4, i);
+        }
+    }
+    return scalar::FindUnsorted(data, size, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindUnsorted(const std::int32_t* data, TSpanIndex size) noexcept
+{
+    TSpanIndex i = 1;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i - 1));
+        const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (0 != _mm256_movemask_epi8(_mm256_cmpgt_epi32(previous, current)))
+        {
+            return scalar::FindUnsorted(data, i + 8, i);
+        }
+    }
+    return scalar::FindUnsorted(data, size, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindUnsorted(const std::int64_t* data, TSpanIndex size) noexcept
+{
+    TSpanIndex i = 1;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i - 1));
+        const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (0 != _mm256_movemask_epi8(_mm256_cmpgt_epi64(previous, current)))
+        {
+            return scalar::FindUnsorted(data, i + 4, i);
+        }
+    }
+    return scalar::FindUnsorted(data, size, i);
+}
+
+DBGH_TARGET_AVX2 TSpanIndex FindNull(const void* const* data, TSpanIndex size) noexcept
+{
+    const __m256i zero = _mm256_setzero_si256();
+    TSpanIndex i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (0 != _mm256_movemask_epi8(_mm256_cmpeq_epi64(value, zero)))
+        {
+            return scalar::FindNull(data, i + 4, i);
+        }
+    }
+    return scalar::FindNull(data, size, i);
+}
+
+} // namespace avx2
+
+/**
+ * @internal
+ * @brief      Checks once if the CPU supports AVX2.
+ */
+bool HasAvx2() noexcept
+{
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    return hasAvx2;
+}
+
+#define DBGH_RANGE_CHECK_DISPATCH(_function_, ...)                                                                                      \
+    return HasAvx2() ? avx2::_function_(__VA_ARGS__) : sse2::_function_(__VA_ARGS__)
+
+#define DBGH_RANGE_CHECK_DISPATCH_AVX2(_function_, ...)                                                                                 \
+    return HasAvx2() ? avx2::_function_(__VA_ARGS__) : scalar::_function_(__VA_ARGS__, 0)
+
+#elif DBGH_RANGE_CHECK_X86
+
+#define DBGH_RANGE_CHECK_DISPATCH(_function_, ...)       return sse2::_function_(__VA_ARGS__)
+#define DBGH_RANGE_CHECK_DISPATCH_AVX2(_function_, ...)  return scalar::_function_(__VA_ARGS__, 0)
+
+#else
+
+#define DBGH_RANGE_CHECK_DISPATCH(_function_, ...)       return scalar::_function_(__VA_ARGS__, 0)
+#define DBGH_RANGE_CHECK_DISPATCH_AVX2(_function_, ...)  return scalar::_function_(__VA_ARGS__, 0)
+
+#endif // DBGH_RANGE_CHECK_AVX2
+
+}  // unnamed namespace
+
+std::size_t CRangeCheck::findNonFinite(std::span<const float> values) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH(FindNonFinite, values.data(), values.size());
+}
+
+std::size_t CRangeCheck::findNonFinite(std::span<const double> values) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH(FindNonFinite, values.data(), values.size());
+}
+
+std::size_t CRangeCheck::findOutOfRange(std::span<const float> values, float lo, float hi) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH(FindOutOfRange, values.data(), values.size(), lo, hi);
+}
+
+std::size_t CRangeCheck::findOutOfRange(std::span<const double> values, double lo, double hi) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH(FindOutOfRange, values.data(), values.size(), lo, hi);
+}
+
+std::size_t CRangeCheck::findOutOfRange(
+        std::span<const std::int32_t> values, std::int32_t lo, std::int32_t hi) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH(FindOutOfRange, values.data(), values.size(), lo, hi);
+}
+
+std::size_t CRangeCheck::findOutOfRange(
+        std::span<const std::int64_t> values, std::int64_t lo, std::int64_t hi) noexcept
+{
+    // SSE2 has no 64-bit comparison, only AVX2 is vectorized.
+    DBGH_RANGE_CHECK_DISPATCH_AVX2(FindOutOfRange, values.data(), values.size(), lo, hi);
+}
+
+std::size_t CRangeCheck::findUnsorted(std::span<const float> values) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH(FindUnsorted, values.data(), values.size());
+}
+
+std::size_t CRangeCheck::findUnsorted(std::span<const double> values) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH(FindUnsorted, values.data(), values.size());
+}
+
+std::size_t CRangeCheck::findUnsorted(std::span<const std::int32_t> values) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH(FindUnsorted, values.data(), values.size());
+}
+
+std::size_t CRangeCheck::findUnsorted(std::span<const std::int64_t> values) noexcept
+{
+    // SSE2 has no 64-bit comparison, only AVX2 is vectorized.
+    DBGH_RANGE_CHECK_DISPATCH_AVX2(FindUnsorted, values.data(), values.size());
+}
+
+std::size_t CRangeCheck::findNull(std::span<const void* const> values) noexcept
+{
+    DBGH_RANGE_CHECK_DISPATCH_AVX2(FindNull, values.data(), values.size());
+}
+
+} // namespace dbgh::impl
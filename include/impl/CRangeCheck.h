@@ -0,0 +1,296 @@
+/**
+ * @file        CRangeCheck.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CRangeCheck class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CRangeCheck
+ * @brief      The vectorized kernels for the assertions over numeric buffers.
+ *
+ * @details    The float, double, int32, int64 and pointer buffers are checked by SSE2 or AVX2 kernels, the
+ *              instruction set is selected at runtime. The other element types and the other platforms use
+ *              a scalar loop. Each function returns the index of the first element that violates the check,
+ *              or \ref npos if there is no such element.
+ */
+class CRangeCheck
+{
+public:
+
+    /**
+     * @brief      The value returned if there is no failing element.
+     */
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    CRangeCheck() = delete;
+
+    ~CRangeCheck() = delete;
+
+    CRangeCheck(CRangeCheck&&) noexcept = delete;
+
+    CRangeCheck(const CRangeCheck&) = delete;
+
+    CRangeCheck& operator=(CRangeCheck&&) = delete;
+
+    CRangeCheck& operator=(const CRangeCheck&) = delete;
+
+    /**
+     * @brief      Finds the first element which is NaN or infinity.
+     *
+     * @param[in]  range  The contiguous range of floating point values.
+     *
+     * @return     The index of the failing element, or \ref npos.
+     */
+    template <typename TRange>
+    [[nodiscard]] static std::size_t FindNonFinite(const TRange& range) noexcept
+    {
+        const auto values = toSpan(range);
+        using TValue = typename decltype(values)::value_type;
+        static_assert(std::is_floating_point_v<TValue>, "ASSERT_ALL_FINITE requires a range of floating point values.");
+        if constexpr (std::is_same_v<TValue, float> || std::is_same_v<TValue, double>)
+        {
+            return findNonFinite(values);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                if (! std::isfinite(values[i]))
+                {
+                    return i;
+                }
+            }
+            return npos;
+        }
+    }
+
+    /**
+     * @brief      Finds the first element which is not in the closed interval [lo, hi].
+     *
+     * @details    The bounds can have other types than the values. The integers are compared by their values
+     *              (as std::cmp_less_equal does), the other pairs by the usual arithmetic conversions. The vectorized
+     *              kernel is used only if both bounds are converted to the value type without changing the result,
+     *              otherwise the scalar loop is used.
+     *
+     * @param[in]  range  The contiguous range of arithmetic values.
+     * @param[in]  lo     The lower bound.
+     * @param[in]  hi     The upper bound.
+     *
+     * @return     The index of the failing element, or \ref npos.
+     */
+    template <typename TRange, typename TLow, typename THigh>
+    [[nodiscard]] static std::size_t FindOutOfRange(const TRange& range, const TLow& lo, const THigh& hi) noexcept
+    {
+        const auto values = toSpan(range);
+        using TValue = typename decltype(values)::value_type;
+        static_assert(std::is_arithmetic_v<TValue>, "ASSERT_IN_RANGE requires a range of arithmetic values.");
+        static_assert(std::is_arithmetic_v<TLow> && std::is_arithmetic_v<THigh>, "ASSERT_IN_RANGE requires arithmetic bounds.");
+        if constexpr (isVectorized<TValue>())
+        {
+            if (isExactBound<TValue>(lo) && isExactBound<TValue>(hi))
+            {
+                return findOutOfRange(values, static_cast<TValue>(lo), static_cast<TValue>(hi));
+            }
+        }
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            if (! (lessEqual(lo, values[i]) && lessEqual(values[i], hi)))
+            {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * @brief      Finds the first element which is less than the previous one.
+     *
+     * @param[in]  range  The contiguous range of arithmetic values.
+     *
+     * @return     The index of the failing element, or \ref npos.
+     */
+    template <typename TRange>
+    [[nodiscard]] static std::size_t FindUnsorted(const TRange& range) noexcept
+    {
+        const auto values = toSpan(range);
+        using TValue = typename decltype(values)::value_type;
+        static_assert(std::is_arithmetic_v<TValue>, "ASSERT_SORTED requires a range of arithmetic values.");
+        if constexpr (isVectorized<TValue>())
+        {
+            return findUnsorted(values);
+        }
+        else
+        {
+            for (std::size_t i = 1; i < values.size(); ++i)
+            {
+                if (! (values[i - 1] <= values[i]))
+                {
+                    return i;
+                }
+            }
+            return npos;
+        }
+    }
+
+    /**
+     * @brief      Finds the first null pointer.
+     *
+     * @param[in]  range  The contiguous range of pointers.
+     *
+     * @return     The index of the failing element, or \ref npos.
+     */
+    template <typename TRange>
+    [[nodiscard]] static std::size_t FindNull(const TRange& range) noexcept
+    {
+        const auto values = toSpan(range);
+        using TValue = typename decltype(values)::value_type;
+        static_assert(std::is_pointer_v<TValue>, "ASSERT_NONE_NULL requires a range of pointers.");
+        static_assert(sizeof(TValue) == sizeof(const void*));
+        return findNull({ reinterpret_cast<const void* const*>(values.data()), values.size() });
+    }
+
+    /**
+     * @brief      Gets the element of the range by index in the form suitable for the formatting.
+     *
+     * @param[in]  range  The contiguous range.
+     * @param[in]  index  The index of the element.
+     *
+     * @return     The element value, the pointers are returned as const void*.
+     */
+    template <typename TRange>
+    [[nodiscard]] static auto ValueAt(const TRange& range, std::size_t index) noexcept
+    {
+        const auto value = toSpan(range)[index];
+        if constexpr (std::is_pointer_v<decltype(value)>)
+        {
+            return static_cast<const void*>(value);
+        }
+        else
+        {
+            return value;
+        }
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      Makes the read-only span over the contiguous range.
+     */
+    template <typename TRange>
+    [[nodiscard]] static auto toSpan(const TRange& range) noexcept
+    {
+        using TValue = std::remove_cv_t<std::ranges::range_value_t<TRange>>;
+        return std::span<const TValue> { std::ranges::data(range), std::ranges::size(range) };
+    }
+
+    /**
+     * @internal
+     * @brief      Checks if the type has the vectorized kernels.
+     */
+    template <typename TValue>
+    [[nodiscard]] static constexpr bool isVectorized() noexcept
+    {
+        return std::is_same_v<TValue, float> || std::is_same_v<TValue, double>
+            || std::is_same_v<TValue, std::int32_t> || std::is_same_v<TValue, std::int64_t>;
+    }
+
+    /**
+     * @internal
+     * @brief      Compares the arithmetic values of different types, the integers are compared by their values.
+     */
+    template <typename TLeft, typename TRight>
+    [[nodiscard]] static constexpr bool lessEqual(const TLeft left, const TRight right) noexcept
+    {
+        if constexpr (std::is_integral_v<TLeft> && std::is_integral_v<TRight>)
+        {
+            // The unary plus promotes bool and the character types, which std::cmp_less_equal does not accept.
+            return std::cmp_less_equal(+left, +right);
+        }
+        else
+        {
+            // The usual arithmetic conversions, written out.
+            using TCommon = std::common_type_t<TLeft, TRight>;
+            return static_cast<TCommon>(left) <= static_cast<TCommon>(right);
+        }
+    }
+
+    /**
+     * @internal
+     * @brief      Checks if the bound converted to the value type is compared with the values as the bound itself.
+     */
+    template <typename TValue, typename TBound>
+    [[nodiscard]] static bool isExactBound([[maybe_unused]] const TBound bound) noexcept
+    {
+        if constexpr (std::is_same_v<TValue, TBound>)
+        {
+            return true;
+        }
+        else if constexpr (std::is_integral_v<TValue> && std::is_integral_v<TBound>)
+        {
+            return std::in_range<TValue>(+bound);
+        }
+        else if constexpr (std::is_floating_point_v<TValue> && std::is_integral_v<TBound>)
+        {
+            // The mixed comparison converts the integer bound to the floating value type as the cast does.
+            return true;
+        }
+        else if constexpr (std::is_floating_point_v<TValue>)
+        {
+            // The narrower floating bound is converted exactly, the wider one must be representable.
+            if constexpr (sizeof(TBound) <= sizeof(TValue))
+            {
+                return true;
+            }
+            else
+            {
+                return std::isnan(bound) || std::isinf(bound)
+                       || (std::fabs(bound) <= std::numeric_limits<TValue>::max()
+                           && ! std::islessgreater(static_cast<TBound>(static_cast<TValue>(bound)), bound));
+            }
+        }
+        else
+        {
+            // The integer values are converted to the floating bound type by the mixed comparison, the kernel is
+            // exact only if the conversion is exact and the bound is an integer in the range of the value type.
+            return std::numeric_limits<TValue>::digits <= std::numeric_limits<TBound>::digits
+                   && static_cast<TBound>(std::numeric_limits<TValue>::min()) <= bound
+                   && bound <= static_cast<TBound>(std::numeric_limits<TValue>::max())
+                   && ! std::islessgreater(std::trunc(bound), bound);
+        }
+    }
+
+    static std::size_t findNonFinite(std::span<const float> values) noexcept;
+    static std::size_t findNonFinite(std::span<const double> values) noexcept;
+
+    static std::size_t findOutOfRange(std::span<const float> values, float lo, float hi) noexcept;
+    static std::size_t findOutOfRange(std::span<const double> values, double lo, double hi) noexcept;
+    static std::size_t findOutOfRange(std::span<const std::int32_t> values, std::int32_t lo, std::int32_t hi) noexcept;
+    static std::size_t findOutOfRange(std::span<const std::int64_t> values, std::int64_t lo, std::int64_t hi) noexcept;
+
+    static std::size_t findUnsorted(std::span<const float> values) noexcept;
+    static std::size_t findUnsorted(std::span<const double> values) noexcept;
+    static std::size_t findUnsorted(std::span<const std::int32_t> values) noexcept;
+    static std::size_t findUnsorted(std::span<const std::int64_t> values) noexcept;
+
+    static std::size_t findNull(std::span<const void* const> values) noexcept;
+};
+
+} // namespace dbgh::impl
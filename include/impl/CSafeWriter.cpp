@@ -0,0 +1,168 @@
+/**
+ * @file        CSafeWriter.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CSafeWriter class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <cerrno>
+#include <cmath>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "CSafeWriter.h"
+
+namespace dbgh::impl
+{
+
+CSafeWriter::CSafeWriter(const int descriptor, char* buffer, const std::size_t capacity) noexcept
+        : m_iDescriptor { descriptor }
+        , m_pBuffer { buffer }
+        , m_uCapacity { capacity }
+        , m_uSize { 0 }
+{ }
+
+CSafeWriter::~CSafeWriter()
+{
+    Flush();
+}
+
+CSafeWriter& CSafeWriter::Write(const char* text) noexcept
+{
+    if (nullptr == text)
+    {
+        return Write(std::string_view { "(null)" });
+    }
+    for (; '\0' != *text; ++text)
+    {
+        put(*text);
+    }
+    return *this;
+}
+
+CSafeWriter& CSafeWriter::Write(const std::string_view text) noexcept
+{
+    for (const auto ch : text)
+    {
+        put(ch);
+    }
+    return *this;
+}
+
+CSafeWriter& CSafeWriter::WriteSigned(const std::int64_t value) noexcept
+{
+    if (value < 0)
+    {
+        put('-');
+        return WriteUnsigned(std::uint64_t { 0 } - static_cast<std::uint64_t>(value));
+    }
+    return WriteUnsigned(static_cast<std::uint64_t>(value));
+}
+
+CSafeWriter& CSafeWriter::WriteUnsigned(std::uint64_t value) noexcept
+{
+    char digits[20];
+    std::size_t count = 0;
+    do
+    {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (0 != value);
+    while (0 != count)
+    {
+        put(digits[--count]);
+    }
+    return *this;
+}
+
+CSafeWriter& CSafeWriter::WriteHex(std::uint64_t value) noexcept
+{
+    char digits[16];
+    std::size_t count = 0;
+    do
+    {
+        digits[count++] = "0123456789abcdef"[value & 0xF];
+        value >>= 4;
+    } while (0 != value);
+    Write(std::string_view { "0x" });
+    while (0 != count)
+    {
+        put(digits[--count]);
+    }
+    return *this;
+}
+
+CSafeWriter& CSafeWriter::WriteFloating(double value) noexcept
+{
+    if (std::isnan(value))
+    {
+        return Write(std::string_view { "nan" });
+    }
+    if (value < 0)
+    {
+        put('-');
+        value = -value;
+    }
+    if (value >= 1.8446744073709552e19)
+    {
+        return Write(std::string_view { "inf-or-huge" });
+    }
+    auto integral = static_cast<std::uint64_t>(value);
+    auto fraction = static_cast<std::uint64_t>((value - static_cast<double>(integral)) * 1e6 + 0.5);
+    if (fraction >= 1000000)
+    {
+        ++integral;
+        fraction -= 1000000;
+    }
+    WriteUnsigned(integral);
+    put('.');
+    for (std::uint64_t divisor = 100000; 0 != divisor; divisor /= 10)
+    {
+        put(static_cast<char>('0' + (fraction / divisor) % 10));
+    }
+    return *this;
+}
+
+void CSafeWriter::Flush() noexcept
+{
+    WriteAll(m_iDescriptor, m_pBuffer, m_uSize);
+    m_uSize = 0;
+}
+
+void CSafeWriter::WriteAll(const int descriptor, const char* data, std::size_t size) noexcept
+{
+    while (0 != size)
+    {
+#ifdef _WIN32
+        const auto written = _write(descriptor, data, static_cast<unsigned int>(size));
+#else
+        const auto written = write(descriptor, data, size);
+#endif
+        if (written < 0 && EINTR == errno)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            return;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+void CSafeWriter::put(const char ch) noexcept
+{
+    if (m_uSize == m_uCapacity)
+    {
+        Flush();
+    }
+    m_pBuffer[m_uSize++] = ch;
+}
+
+} // namespace dbgh::impl
@@ -0,0 +1,133 @@
+/**
+ * @file        CSafeWriter.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CSafeWriter class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CSafeWriter
+ * @brief      The async-signal-safe writer of the text into the file descriptor.
+ *
+ * @details    The text is collected in the buffer given by the caller and written by raw write(2) when the buffer
+ *              is full and on \ref Flush. Nothing is allocated, locked or formatted by the standard library,
+ *              so the writer can be used in the signal handlers and after the heap corruption.
+ *              The errors of write(2) are ignored, EINTR is retried.
+ */
+class CSafeWriter
+{
+public:
+
+    /**
+     * @brief      Constructs the writer.
+     *
+     * @param[in]  descriptor  The file descriptor.
+     * @param[in]  buffer      The buffer, must outlive the writer.
+     * @param[in]  capacity    The size of the buffer.
+     */
+    CSafeWriter(int descriptor, char* buffer, std::size_t capacity) noexcept;
+
+    /**
+     * @brief      Writes the rest of the buffer.
+     */
+    ~CSafeWriter();
+
+    CSafeWriter(CSafeWriter&&) noexcept = delete;
+
+    CSafeWriter(const CSafeWriter&) = delete;
+
+    CSafeWriter& operator=(CSafeWriter&&) noexcept = delete;
+
+    CSafeWriter& operator=(const CSafeWriter&) = delete;
+
+    /**
+     * @brief      Appends the text, the null pointer is written as "(null)".
+     */
+    CSafeWriter& Write(const char* text) noexcept;
+
+    /**
+     * @brief      Appends the text.
+     */
+    CSafeWriter& Write(std::string_view text) noexcept;
+
+    /**
+     * @brief      Appends the signed integer in decimal.
+     */
+    CSafeWriter& WriteSigned(std::int64_t value) noexcept;
+
+    /**
+     * @brief      Appends the unsigned integer in decimal.
+     */
+    CSafeWriter& WriteUnsigned(std::uint64_t value) noexcept;
+
+    /**
+     * @brief      Appends the unsigned integer in hexadecimal with the 0x prefix.
+     */
+    CSafeWriter& WriteHex(std::uint64_t value) noexcept;
+
+    /**
+     * @brief      Appends the floating point value with six fractional digits.
+     */
+    CSafeWriter& WriteFloating(double value) noexcept;
+
+    /**
+     * @brief      Writes the collected text into the file descriptor.
+     */
+    void Flush() noexcept;
+
+    /**
+     * @brief      Writes the whole text into the file descriptor, retries the partial writes and EINTR.
+     *
+     * @param[in]  descriptor  The file descriptor.
+     * @param[in]  data        The text.
+     * @param[in]  size        The size of the text.
+     */
+    static void WriteAll(int descriptor, const char* data, std::size_t size) noexcept;
+
+private:
+
+    /**
+     * @internal
+     * @brief      Appends one character.
+     */
+    void put(char ch) noexcept;
+
+private:
+
+    /**
+     * @internal
+     * @brief      The file descriptor.
+     */
+    int m_iDescriptor;
+
+    /**
+     * @internal
+     * @brief      The buffer.
+     */
+    char* m_pBuffer;
+
+    /**
+     * @internal
+     * @brief      The size of the buffer.
+     */
+    std::size_t m_uCapacity;
+
+    /**
+     * @internal
+     * @brief      The count of collected characters.
+     */
+    std::size_t m_uSize;
+};
+
+} // namespace dbgh::impl
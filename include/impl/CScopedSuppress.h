@@ -0,0 +1,74 @@
+/**
+ * @file        CScopedSuppress.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CScopedSuppress class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include "CAssertConfig.h"
+
+namespace dbgh
+{
+
+/**
+ * @class      CScopedSuppress
+ * @brief      Suppresses the asserts of the given levels on the calling thread while the object is alive.
+ *
+ * @details    The suppressed levels are kept in a thread-local mask of \ref dbgh::CAssertConfig, the other threads and the process-wide
+ *              state of \ref dbgh::CAssertConfig are not changed. The suppressions can be nested, the destructor
+ *              restores the mask which was active before the constructor, so the objects must be destroyed
+ *              in the reverse order on the same thread (as the automatic variables are).
+ *
+ * @example    {
+ *                 dbgh::CScopedSuppress suppress { dbgh::LevelMask(dbgh::EAssertLevel::Warning) };
+ *                 IngestLegacyData(records);
+ *             }
+ */
+class CScopedSuppress
+{
+public:
+    /**
+     * @brief      Suppresses the given levels on the calling thread.
+     *
+     * @param[in]  levels  The mask of the levels, see \ref dbgh::LevelMask.
+     */
+    explicit CScopedSuppress(const TLevelMask levels) noexcept
+            : m_uPrevious { CAssertConfig::s_uSuppressedLevels }
+    {
+        CAssertConfig::s_uSuppressedLevels |= levels;
+    }
+
+    ~CScopedSuppress()
+    {
+        CAssertConfig::s_uSuppressedLevels = m_uPrevious;
+    }
+
+    CScopedSuppress(CScopedSuppress&&) noexcept = delete;
+
+    CScopedSuppress(const CScopedSuppress&) = delete;
+
+    CScopedSuppress& operator=(CScopedSuppress&&) = delete;
+
+    CScopedSuppress& operator=(const CScopedSuppress&) = delete;
+
+    /**
+     * @brief      Gets the mask of the levels suppressed on the calling thread.
+     */
+    [[nodiscard]] static TLevelMask GetSuppressed() noexcept
+    {
+        return CAssertConfig::s_uSuppressedLevels;
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      The mask which was suppressed before this object.
+     */
+    const TLevelMask m_uPrevious;
+};
+
+} // namespace dbgh
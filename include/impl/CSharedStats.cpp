@@ -0,0 +1,226 @@
+/**
+ * @file        CSharedStats.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CSharedStats class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "CAssertException.h"
+#include "CSharedStats.h"
+#include "SSharedStats.h"
+
+namespace dbgh::impl
+{
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      The mapped segment, nullptr if the statistics are not published.
+ */
+constinit std::atomic<SSharedStats*> s_pStats { nullptr };
+
+/**
+ * @internal
+ * @brief      The address of the mapping, kept until the exit and reused by the next Enable, guarded by s_mtxSegment.
+ */
+void* s_pMapping { nullptr };
+
+/**
+ * @internal
+ * @brief      The mutex of Enable and Disable.
+ */
+std::mutex s_mtxSegment;
+
+/**
+ * @internal
+ * @brief      True if the segment is removed at exit.
+ */
+bool s_bUnlinkAtExit { false };
+
+constexpr std::uint64_t s_uSiteMask = SSharedStats::s_uSiteCapacity - 1;
+static_assert(0 == (SSharedStats::s_uSiteCapacity & s_uSiteMask), "The site capacity must be a power of two.");
+
+[[nodiscard]] std::string SegmentName()
+{
+#ifndef _WIN32
+    return "/dbgh." + std::to_string(getpid());
+#else
+    return { };
+#endif
+}
+
+[[nodiscard]] std::uint64_t SiteKey(const char* file, const TLine line, const EAssertLevel level) noexcept
+{
+    auto key = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(file))
+               ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(line)) << 32)
+               ^ static_cast<std::uint64_t>(level);
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return (key ^ (key >> 31)) | 1;
+}
+
+/**
+ * @internal
+ * @brief      Copies the null-terminated text, keeps the tail if the text is too long.
+ */
+void CopyTail(char* destination, const std::size_t capacity, const char* source) noexcept
+{
+    if (nullptr == source)
+    {
+        source = "";
+    }
+    std::size_t length = 0;
+    while ('\0' != source[length])
+    {
+        ++length;
+    }
+    const auto offset = length >= capacity ? length - capacity + 1 : 0;
+    std::size_t i = 0;
+    for (; offset + i < length; ++i)
+    {
+        destination[i] = source[offset + i];
+    }
+    destination[i] = '\0';
+}
+
+void UnlinkAtExit()
+{
+    CSharedStats::Disable();
+}
+
+}  // unnamed namespace
+
+bool CSharedStats::Enable() noexcept
+{
+#ifndef _WIN32
+    const std::lock_guard lock { s_mtxSegment };
+    if (nullptr != s_pStats.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+    IMPL_DBGH_TRY
+    {
+        // A stale segment with the same name may be owned by another user or readable by others, it is removed
+        // and the new segment is created exclusively. If the name is taken again in between, the segment is refused.
+        const auto name = SegmentName();
+        shm_unlink(name.c_str());
+        const int descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (descriptor < 0)
+        {
+            return false;
+        }
+        // The new segment replaces the previous mapping at the same address, the threads which still hold the
+        // pointer loaded before Disable write into the new segment instead of the unmapped memory.
+        void* memory = MAP_FAILED;
+        if (0 == ftruncate(descriptor, static_cast<off_t>(sizeof(SSharedStats))))
+        {
+            memory = mmap(s_pMapping, sizeof(SSharedStats), PROT_READ | PROT_WRITE
+                          , MAP_SHARED | (nullptr != s_pMapping ? MAP_FIXED : 0), descriptor, 0);
+        }
+        close(descriptor);
+        if (MAP_FAILED == memory)
+        {
+            shm_unlink(name.c_str());
+            return false;
+        }
+        s_pMapping = memory;
+
+        // The new segment is zero-filled, that is the empty state of all counters and sites.
+        auto* stats = static_cast<SSharedStats*>(memory);
+        stats->m_uVersion = SSharedStats::s_uVersion;
+        stats->m_uPid = static_cast<std::uint64_t>(getpid());
+        stats->m_uStartTime = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+        std::atomic_thread_fence(std::memory_order_release);
+        stats->m_uMagic = SSharedStats::s_uMagic;
+        s_pStats.store(stats, std::memory_order_release);
+
+        if (! s_bUnlinkAtExit)
+        {
+            s_bUnlinkAtExit = (0 == std::atexit(&UnlinkAtExit));
+        }
+        return true;
+    }
+    IMPL_DBGH_CATCH(...)
+    {
+        return false;
+    }
+#else
+    return false;
+#endif
+}
+
+void CSharedStats::Disable() noexcept
+{
+#ifndef _WIN32
+    const std::lock_guard lock { s_mtxSegment };
+    // The mapping is kept until the exit, the failing threads can still write into it, the next Enable reuses it.
+    if (nullptr != s_pStats.exchange(nullptr, std::memory_order_acq_rel))
+    {
+        IMPL_DBGH_TRY
+        {
+            shm_unlink(SegmentName().c_str());
+        }
+        IMPL_DBGH_CATCH(...)
+        {
+        }
+    }
+#endif
+}
+
+void CSharedStats::Record(
+        const EAssertLevel level, const char* expression, const char* file, const TLine line,
+        const char* function) noexcept
+{
+    auto* stats = s_pStats.load(std::memory_order_acquire);
+    if (nullptr == stats)
+    {
+        return;
+    }
+    const auto levelIndex = static_cast<std::size_t>(level);
+    if (levelIndex < SSharedStats::s_uLevelCount)
+    {
+        stats->m_arrLevelFailures[levelIndex].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const auto key = SiteKey(file, line, level);
+    for (std::uint64_t probe = 0; probe < SSharedStats::s_uSiteCapacity; ++probe)
+    {
+        auto& site = stats->m_arrSites[(key + probe) & s_uSiteMask];
+        auto current = site.m_uKey.load(std::memory_order_acquire);
+        if (0 == current && site.m_uKey.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+        {
+            site.m_uSequence.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            site.m_uLevel = static_cast<std::uint32_t>(level);
+            site.m_iLine = static_cast<std::int32_t>(line);
+            CopyTail(site.m_arrFile, SSharedSiteStats::s_uFileSize, file);
+            CopyTail(site.m_arrFunction, SSharedSiteStats::s_uFunctionSize, function);
+            CopyTail(site.m_arrExpression, SSharedSiteStats::s_uExpressionSize, expression);
+            site.m_uSequence.store(2, std::memory_order_release);
+            current = key;
+        }
+        if (key == current)
+        {
+            site.m_uFailures.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    stats->m_uDroppedSites.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace dbgh::impl
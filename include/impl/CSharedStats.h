@@ -0,0 +1,68 @@
+/**
+ * @file        CSharedStats.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CSharedStats class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include "CAssertConfig.h"
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CSharedStats
+ * @brief      Publishes the failure counters per level and per site into the POSIX shared-memory segment.
+ *
+ * @details    The segment /dev/shm/dbgh.<pid> has the layout \ref SSharedStats. The failures are counted by atomic
+ *              increments, the readers (for example dbgh_top) map the segment read-only and add no overhead
+ *              to the asserting process. If the segment is not created, \ref Record only checks a pointer.
+ */
+class CSharedStats
+{
+public:
+    CSharedStats() = delete;
+
+    ~CSharedStats() = delete;
+
+    CSharedStats(CSharedStats&&) noexcept = delete;
+
+    CSharedStats(const CSharedStats&) = delete;
+
+    CSharedStats& operator=(CSharedStats&&) = delete;
+
+    CSharedStats& operator=(const CSharedStats&) = delete;
+
+    /**
+     * @brief      Creates and maps the segment of the current process, readable and writable only by its owner.
+     *
+     * @details    A stale segment with the same name is replaced, the segment is always created by the process.
+     *              After \ref Disable the new segment is mapped at the address of the previous one.
+     *
+     * @return     True if the segment is available, False otherwise.
+     */
+    static bool Enable() noexcept;
+
+    /**
+     * @brief      Stops the publishing and removes the segment, the mapping is kept for the next \ref Enable.
+     */
+    static void Disable() noexcept;
+
+    /**
+     * @brief      Counts the failure of the site, async-signal-safe.
+     *
+     * @param[in]  level       The assert level.
+     * @param[in]  expression  Expression of the assertion.
+     * @param[in]  file        The filename, as a string with static storage duration.
+     * @param[in]  line        The line number.
+     * @param[in]  function    The function name.
+     */
+    static void Record(
+            EAssertLevel level, const char* expression, const char* file, TLine line, const char* function) noexcept;
+};
+
+} // namespace dbgh::impl
@@ -0,0 +1,51 @@
+/**
+ * @file        CTsc.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CTsc class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include <thread>
+
+#include "CTsc.h"
+
+namespace dbgh::impl
+{
+
+namespace
+{
+
+/**
+ * @internal
+ * @brief      Measures the count of ticks per nanosecond.
+ */
+[[nodiscard]] double CalibrateTicksPerNanosecond() noexcept
+{
+#ifdef DBGH_HAS_RDTSC
+    using namespace std::chrono_literals;
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto startTicks = CTsc::Now();
+    std::this_thread::sleep_for(10ms);
+    const auto endTicks = CTsc::Now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+    if (elapsed <= 0 || endTicks <= startTicks)
+    {
+        return 1.0;
+    }
+    return static_cast<double>(endTicks - startTicks) / static_cast<double>(elapsed);
+#else
+    return 1.0;
+#endif
+}
+
+}  // unnamed namespace
+
+std::uint64_t CTsc::ToNanoseconds(const std::uint64_t ticks) noexcept
+{
+    static const double s_dTicksPerNanosecond = CalibrateTicksPerNanosecond();
+    return static_cast<std::uint64_t>(static_cast<double>(ticks) / s_dTicksPerNanosecond);
+}
+
+} // namespace dbgh::impl
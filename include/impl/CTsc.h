@@ -0,0 +1,76 @@
+/**
+ * @file        CTsc.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for CTsc class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define DBGH_HAS_RDTSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define DBGH_HAS_RDTSC 1
+#endif
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @class      CTsc
+ * @brief      The cheap timestamps for measuring the short intervals.
+ *
+ * @details    On x86 the time stamp counter is read by rdtsc, the ticks are converted to nanoseconds by the
+ *              frequency calibrated once against std::chrono::steady_clock. On the other platforms the ticks are
+ *              nanoseconds of std::chrono::steady_clock.
+ */
+class CTsc
+{
+public:
+    CTsc() = delete;
+
+    ~CTsc() = delete;
+
+    CTsc(CTsc&&) noexcept = delete;
+
+    CTsc(const CTsc&) = delete;
+
+    CTsc& operator=(CTsc&&) = delete;
+
+    CTsc& operator=(const CTsc&) = delete;
+
+    /**
+     * @brief      Reads the current timestamp.
+     *
+     * @return     The timestamp in ticks.
+     */
+    static std::uint64_t Now() noexcept
+    {
+#ifdef DBGH_HAS_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief      Converts the ticks to nanoseconds.
+     *
+     * @details    The first call calibrates the frequency and takes about ten milliseconds.
+     *
+     * @param[in]  ticks  The count of ticks.
+     *
+     * @return     The nanoseconds.
+     */
+    [[nodiscard]] static std::uint64_t ToNanoseconds(std::uint64_t ticks) noexcept;
+};
+
+} // namespace dbgh::impl
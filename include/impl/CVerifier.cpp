@@ -0,0 +1,20 @@
+/**
+ * @file        CVerifier.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Implementation for CVerifier class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#include "CVerifier.h"
+#include "CAssertHandler.h"
+
+namespace dbgh::impl
+{
+
+void CVerifier::report(const SAssertSite& site, const std::string& message)
+{
+    CAssertHandler::HandleVerify(message, site.m_strExpression, site.m_strFile, site.m_iLine, site.m_strFunction);
+}
+
+} // namespace dbgh::impl
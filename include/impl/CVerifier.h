@@ -0,0 +1,226 @@
+/**
+ * @file        CVerifier.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for SAssertError struct and CVerifier class.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <version>
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#include <expected>
+#endif
+
+#include "CAssertConfig.h"
+#include "CAssertSite.h"
+#include "CCircuitBreaker.h"
+#include "CExpressionText.h"
+
+namespace dbgh
+{
+
+/**
+ * @struct     SAssertError
+ * @brief      The failed verification returned by \ref DBGH_VERIFY.
+ *
+ * @details    The error is only the pointer to the static site descriptor of the verification, so it is returned in
+ *              one register as cheap as an int. The message is not stored, it is reported through
+ *              \ref dbgh::CHandlerExecutor::HandleVerify at the failure.
+ */
+struct SAssertError
+{
+    /**
+     * @brief      Gets the level of the verification.
+     */
+    [[nodiscard]] EAssertLevel Level() const noexcept
+    {
+        return m_pSite->m_eLevel;
+    }
+
+    /**
+     * @brief      Gets the verified expression, as a string.
+     */
+    [[nodiscard]] const char* Expression() const noexcept
+    {
+        return impl::CExpressionText::Decode(m_pSite->m_strExpression);
+    }
+
+    /**
+     * @brief      Gets the filename that contains the verification.
+     */
+    [[nodiscard]] const char* FileName() const noexcept
+    {
+        return m_pSite->m_strFile;
+    }
+
+    /**
+     * @brief      Gets the line number in the file that contains the verification.
+     */
+    [[nodiscard]] TLine LineNumber() const noexcept
+    {
+        return m_pSite->m_iLine;
+    }
+
+    /**
+     * @brief      Gets the function that contains the verification.
+     */
+    [[nodiscard]] const char* Function() const noexcept
+    {
+        return m_pSite->m_strFunction;
+    }
+
+    /**
+     * @internal
+     * @brief      The site descriptor of the failed verification.
+     */
+    const impl::SAssertSite* m_pSite;
+};
+
+static_assert(std::is_trivially_copyable_v<SAssertError> && sizeof(SAssertError) == sizeof(void*));
+
+
+namespace impl
+{
+
+/**
+ * @internal
+ * @class      CUnexpected
+ * @brief      The failure which is converted to \ref CVerified, used if std::expected is not available.
+ */
+class CUnexpected
+{
+public:
+    constexpr explicit CUnexpected(const SAssertError error) noexcept
+            : m_error { error }
+    { }
+
+    [[nodiscard]] constexpr const SAssertError& error() const noexcept
+    {
+        return m_error;
+    }
+
+private:
+    SAssertError m_error;
+};
+
+/**
+ * @internal
+ * @class      CVerified
+ * @brief      The std::expected<void, SAssertError> replacement, used if std::expected is not available.
+ *
+ * @details    The success is stored as the null site, so the result has the size of one pointer.
+ *              The members have the names of std::expected, the code is the same with both.
+ */
+class CVerified
+{
+public:
+    constexpr CVerified() noexcept = default;
+
+    constexpr CVerified(const CUnexpected& unexpected) noexcept
+            : m_error { unexpected.error() }
+    { }
+
+    [[nodiscard]] constexpr bool has_value() const noexcept
+    {
+        return nullptr == m_error.m_pSite;
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    [[nodiscard]] constexpr const SAssertError& error() const noexcept
+    {
+        return m_error;
+    }
+
+private:
+    SAssertError m_error { nullptr };
+};
+
+} // namespace impl
+
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+
+/**
+ * @brief      The result of \ref DBGH_VERIFY.
+ */
+using TVerified = std::expected<void, SAssertError>;
+
+/**
+ * @brief      The failure returned by \ref DBGH_VERIFY_OR_RETURN, converted to any std::expected<T, SAssertError>.
+ */
+using TUnexpected = std::unexpected<SAssertError>;
+
+#else
+
+using TVerified = impl::CVerified;
+
+using TUnexpected = impl::CUnexpected;
+
+#endif
+
+
+namespace impl
+{
+
+/**
+ * @internal
+ * @class      CVerifier
+ * @brief      Reports the failed verifications of \ref DBGH_VERIFY.
+ */
+class CVerifier
+{
+public:
+    CVerifier() = delete;
+
+    ~CVerifier() = delete;
+
+    CVerifier(CVerifier&&) noexcept = delete;
+
+    CVerifier(const CVerifier&) = delete;
+
+    CVerifier& operator=(CVerifier&&) = delete;
+
+    CVerifier& operator=(const CVerifier&) = delete;
+
+    /**
+     * @brief      Reports the failed verification through the executor as ASSERT_ERROR does, without throwing.
+     *              The report passes the circuit breaker of the site, the muted failure is not formatted.
+     *
+     * @param[in]  site    The site descriptor of the verification.
+     * @param[in]  format  The callable which returns the formatted message.
+     *
+     * @return     The failure for the caller, also if the report is muted.
+     */
+    template <typename TFormat>
+    [[nodiscard]] static TUnexpected Fail(SAssertSite& site, const TFormat& format)
+    {
+        CSiteRegistry::Register(site);
+        if (CCircuitBreaker::ShouldReport(
+                site.m_breaker, site.m_eLevel, site.m_strExpression, site.m_strFile, site.m_iLine, site.m_strFunction))
+        {
+            report(site, format());
+        }
+        return TUnexpected { SAssertError { &site } };
+    }
+
+private:
+
+    /**
+     * @internal
+     * @brief      Reports the failed verification through the executor.
+     */
+    static void report(const SAssertSite& site, const std::string& message);
+};
+
+} // namespace impl
+
+} // namespace dbgh
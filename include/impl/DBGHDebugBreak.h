@@ -0,0 +1,29 @@
+/**
+ * @file        DBGHDebugBreak.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       The debugger break macro of the assertions.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#ifdef _MSC_VER
+
+/**
+ * @brief       START_DEBUGGING intrinsic at any point in your code. __debugbreak has the same effect as setting a breakpoint
+ *               at that location using a debugger.
+ *
+ * @note        Working on Win32 platforms.
+ */
+#define START_DEBUGGING  __debugbreak()
+#else
+
+/**
+ * @brief       START_DEBUGGING intrinsic at any point in your code. __asm__ volatile("int $0x03") has the same effect as
+ *               setting a breakpoint at that location using a debugger.
+ *
+ * @note        Working on GNU platforms.
+ */
+#define START_DEBUGGING __asm__ volatile("int $0x03")
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file        DBGHSdt.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       The minimal SystemTap/USDT probe macros, compatible with the notes of <sys/sdt.h>.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ *
+ * @details     Each probe places one nop instruction and a .note.stapsdt ELF note which describes the probe
+ *              location and the locations of its arguments. The tracers (bpftrace, perf, systemtap) replace the nop
+ *              by a breakpoint when the probe is attached, otherwise the probe costs the nop only.
+ *              The arguments must be integers or pointers. Supported on ELF x86-64 and AArch64 with GCC or Clang,
+ *              on the other targets the probes expand to nothing.
+ *
+ * @example     DBGH_SDT_PROBE2(dbgh, assert_eval, siteId, level);
+ *              bpftrace -e 'usdt:./app:dbgh:assert_eval { @[arg0] = count(); }'
+ */
+
+#pragma once
+
+#if defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__)) && (defined(__GNUC__) || defined(__clang__))
+
+#define DBGH_SDT_SUPPORTED 1
+
+#include <type_traits>
+
+/**
+ * @internal
+ * @brief      The operand constraint of the probe arguments.
+ */
+#if defined(__x86_64__)
+#define DBGH_SDT_ARG_CONSTRAINT "nor"
+#else
+#define DBGH_SDT_ARG_CONSTRAINT "r"
+#endif
+
+/**
+ * @internal
+ * @brief      The size of the argument for the note, positive for signed types because %n negates it.
+ */
+#define DBGH_SDT_ARG_SIZE(_arg_)                                                                                                        \
+    ((std::is_signed_v<std::decay_t<decltype(_arg_)>> ? 1 : -1) * static_cast<int>(sizeof(_arg_)))
+
+#define DBGH_SDT_OPERAND(_n_, _arg_)                                                                                                    \
+    [_s##_n_] "n" (DBGH_SDT_ARG_SIZE(_arg_)), [_a##_n_] DBGH_SDT_ARG_CONSTRAINT (_arg_)
+
+/**
+ * @internal
+ * @brief      The note of one probe, the same layout as in <sys/sdt.h> without the semaphore.
+ */
+#define DBGH_SDT_ASM(_provider_, _name_, _args_)                                                                                        \
+    "990: nop\n"                                                                                                                        \
+    ".pushsection .note.stapsdt,\"?\",\"note\"\n"                                                                                       \
+    ".balign 4\n"                                                                                                                       \
+    ".4byte 992f-991f, 994f-993f, 3\n"                                                                                                  \
+    "991: .asciz \"stapsdt\"\n"                                                                                                         \
+    "992: .balign 4\n"                                                                                                                  \
+    "993: .8byte 990b\n"                                                                                                                \
+    ".8byte _.stapsdt.base\n"                                                                                                           \
+    ".8byte 0\n"                                                                                                                        \
+    ".asciz \"" #_provider_ "\"\n"                                                                                                      \
+    ".asciz \"" #_name_ "\"\n"                                                                                                          \
+    ".asciz \"" _args_ "\"\n"                                                                                                           \
+    "994: .balign 4\n"                                                                                                                  \
+    ".popsection\n"                                                                                                                     \
+    ".ifndef _.stapsdt.base\n"                                                                                                          \
+    ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"                                                             \
+    ".weak _.stapsdt.base\n"                                                                                                            \
+    ".hidden _.stapsdt.base\n"                                                                                                          \
+    "_.stapsdt.base: .space 1\n"                                                                                                        \
+    ".size _.stapsdt.base, 1\n"                                                                                                         \
+    ".popsection\n"                                                                                                                     \
+    ".endif\n"
+
+#define DBGH_SDT_PROBE2(_provider_, _name_, _a1_, _a2_)                                                                                 \
+    __asm__ __volatile__ (DBGH_SDT_ASM(_provider_, _name_, "%n[_s1]@%[_a1] %n[_s2]@%[_a2]")                                             \
+                          :: DBGH_SDT_OPERAND(1, _a1_), DBGH_SDT_OPERAND(2, _a2_))
+
+#define DBGH_SDT_PROBE5(_provider_, _name_, _a1_, _a2_, _a3_, _a4_, _a5_)                                                               \
+    __asm__ __volatile__ (DBGH_SDT_ASM(_provider_, _name_                                                                               \
+                                       , "%n[_s1]@%[_a1] %n[_s2]@%[_a2] %n[_s3]@%[_a3] %n[_s4]@%[_a4] %n[_s5]@%[_a5]")                  \
+                          :: DBGH_SDT_OPERAND(1, _a1_), DBGH_SDT_OPERAND(2, _a2_), DBGH_SDT_OPERAND(3, _a3_)                             \
+                           , DBGH_SDT_OPERAND(4, _a4_), DBGH_SDT_OPERAND(5, _a5_))
+
+#else
+
+#define DBGH_SDT_PROBE2(_provider_, _name_, _a1_, _a2_)                            (void) 0
+#define DBGH_SDT_PROBE5(_provider_, _name_, _a1_, _a2_, _a3_, _a4_, _a5_)          (void) 0
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * @file        SSharedStats.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration for the layout of the shared-memory statistics segment.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace dbgh::impl
+{
+
+/**
+ * @internal
+ * @struct     SSharedSiteStats
+ * @brief      The counters of one failing assertion site in the shared-memory segment.
+ *
+ * @details    The slot is claimed by the first failure of the site: the key is set by compare-and-swap, then the
+ *              text fields are written under the sequence (odd while writing). The readers copy the text fields
+ *              and retry if the sequence was odd or changed. The counter is only incremented.
+ */
+struct SSharedSiteStats
+{
+    static constexpr std::size_t s_uFileSize = 128;
+    static constexpr std::size_t s_uFunctionSize = 64;
+    static constexpr std::size_t s_uExpressionSize = 96;
+
+    std::atomic<std::uint64_t> m_uKey;
+    std::atomic<std::uint32_t> m_uSequence;
+    std::uint32_t m_uLevel;
+    std::int32_t m_iLine;
+    std::atomic<std::uint64_t> m_uFailures;
+    char m_arrFile[s_uFileSize];
+    char m_arrFunction[s_uFunctionSize];
+    char m_arrExpression[s_uExpressionSize];
+};
+
+
+/**
+ * @internal
+ * @struct     SSharedStats
+ * @brief      The versioned layout of the shared-memory statistics segment /dev/shm/dbgh.<pid>.
+ *
+ * @details    The segment is written only by the asserting process. The readers map it read-only and never
+ *              block the writers. A reader must check \ref m_uMagic and \ref m_uVersion before reading the rest.
+ */
+struct SSharedStats
+{
+    static constexpr std::uint32_t s_uMagic = 0x48474244; // "DBGH"
+    static constexpr std::uint32_t s_uVersion = 1;
+    static constexpr std::size_t s_uLevelCount = 8;
+    static constexpr std::size_t s_uSiteCapacity = 1024;
+
+    std::uint32_t m_uMagic;
+    std::uint32_t m_uVersion;
+    std::uint64_t m_uPid;
+    std::uint64_t m_uStartTime;
+    std::atomic<std::uint64_t> m_uDroppedSites;
+    std::atomic<std::uint64_t> m_arrLevelFailures[s_uLevelCount];
+    SSharedSiteStats m_arrSites[s_uSiteCapacity];
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free
+              , "The shared statistics require address-free atomics.");
+
+} // namespace dbgh::impl
@@ -1,6 +1,28 @@
+#include <array>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #include "DBGHAssert.h"
+#include "DBGHCheckedSpan.h"
+
+#ifndef _WIN32
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "impl/SSharedStats.h"
+#endif
+
+DBGH_CHANNEL(storage, 1);
+DBGH_CHANNEL(network, 2);
 
 namespace
 {
@@ -18,6 +40,7 @@ public:
     {
         Logs(message);
         s_bHandleWarningCalled = true;
+        ++s_iWarningCount;
     }
 
     void HandleError(
@@ -28,6 +51,13 @@ public:
         s_bHandleErrorCalled = true;
     }
 
+    void HandleVerify([[maybe_unused]] std::string_view message) override
+    {
+        Logs(message);
+        s_bHandleVerifyCalled = true;
+        ++s_iVerifyCount;
+    }
+
     void Logs([[maybe_unused]] std::string_view message) override
     {
         s_strMessage = message;
@@ -43,13 +73,39 @@ public:
         return s_cUserInput;
     }
 
+    bool IsInteractive() override
+    {
+        return s_bInteractive;
+    }
+
+    bool WaitForUserInput([[maybe_unused]] std::chrono::milliseconds timeout) override
+    {
+        return s_bInputReady;
+    }
+
     static inline bool s_bTerminateCalled = false;
     static inline bool s_bHandleWarningCalled = false;
+    static inline int s_iWarningCount = 0;
     static inline bool s_bHandleErrorCalled = false;
+    static inline bool s_bHandleVerifyCalled = false;
+    static inline int s_iVerifyCount = 0;
     static inline char s_cUserInput = 'i';
+    static inline bool s_bInteractive = true;
+    static inline bool s_bInputReady = true;
     static inline std::string s_strMessage{};
 };
 
+#ifdef DBGH_ASSERTS_EXCEPTIONS
+class ThrowingExecutor : public DummyExecutor
+{
+public:
+    void HandleWarning([[maybe_unused]] std::string_view message) override
+    {
+        throw 42;
+    }
+};
+#endif
+
 }
 
 #define TEST_ASSERT(exp) if (!bool(exp))            \
@@ -109,6 +165,285 @@ void TestWarningAssert()
     dbgh::CAssertConfig::Get().SetExecutor();
 }
 
+void TestLimitedAssert()
+{
+    std::cout << "Start Limited Assert testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_ONCE(i >= 0, "PASS");
+    }
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 0);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_ONCE(i < 0, "FAIL {}", i);
+    }
+#ifndef DEBUG
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 1);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("FAIL 0"));
+
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_FIRST_N(3, i < 0, "FAIL {}", i);
+    }
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 3);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("FAIL 2"));
+
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_EVERY_N(4, i < 0, "FAIL {}", i);
+    }
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 3);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("FAIL 8"));
+#endif
+
+    DummyExecutor::s_iWarningCount = 0;
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Warning);
+    ASSERT_ONCE(2 * 3 == 4, "FAIL");
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 0);
+    std::cout << "End Limited Assert testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestPeriodicAssert()
+{
+    std::cout << "Start Periodic Assert testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    int evaluations = 0;
+    const auto check = [&evaluations]()
+    {
+        ++evaluations;
+        return false;
+    };
+
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_PERIODIC(dbgh::EAssertLevel::Warning, std::chrono::hours { 1 }, check(), "FAIL {}", i);
+    }
+    TEST_ASSERT(evaluations == 1);
+#ifndef DEBUG
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 1);
+#endif
+
+    evaluations = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_PERIODIC(dbgh::EAssertLevel::Warning, std::chrono::milliseconds { 20 }, check(), "FAIL {}", i);
+        ASSERT_PERIODIC(dbgh::EAssertLevel::Warning, std::chrono::milliseconds { 20 }, check(), "FAIL {}", i);
+        std::this_thread::sleep_for(std::chrono::milliseconds { 30 });
+    }
+    TEST_ASSERT(evaluations == 6);
+
+    evaluations = 0;
+    const auto defaultLevels = dbgh::CAssertConfig::Get().GetChannelLevels(dbgh::channels::storage);
+    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage, dbgh::LevelMask());
+    ASSERT_PERIODIC_CH(storage, dbgh::EAssertLevel::Warning, std::chrono::nanoseconds { 0 }, check(), "FAIL");
+    TEST_ASSERT(evaluations == 0);
+    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage, defaultLevels);
+    ASSERT_PERIODIC_CH(storage, dbgh::EAssertLevel::Warning, std::chrono::nanoseconds { 0 }, check(), "FAIL");
+    TEST_ASSERT(evaluations == 1);
+
+#ifndef DEBUG
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(
+            dbgh::EAssertLevel::Warning, 5, dbgh::ECircuitAction::Mute, std::chrono::milliseconds { 50 });
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_PERIODIC(dbgh::EAssertLevel::Warning, std::chrono::nanoseconds { 0 }, 2 * 3 == 4, "FAIL {}", i);
+    }
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 6);
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(dbgh::EAssertLevel::Warning, 0);
+#endif
+
+    evaluations = 0;
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Warning);
+    ASSERT_PERIODIC(dbgh::EAssertLevel::Warning, std::chrono::nanoseconds { 0 }, check(), "FAIL");
+    TEST_ASSERT(evaluations == 0);
+    std::cout << "End Periodic Assert testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestCircuitBreaker()
+{
+    std::cout << "Start Circuit Breaker testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Fatal);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+    const auto failingSite = []()
+    {
+        ASSERT_WARNING(2 * 3 == 4, "FAIL");
+    };
+
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(
+            dbgh::EAssertLevel::Warning, 5, dbgh::ECircuitAction::Mute, std::chrono::milliseconds { 50 });
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        failingSite();
+    }
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 6);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("the site is muted for 50 ms"));
+
+#ifndef DEBUG
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_FIRST_N(1000, 2 * 3 == 4, "FAIL");
+    }
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 6);
+#endif
+
+    std::this_thread::sleep_for(std::chrono::milliseconds { 100 });
+    DummyExecutor::s_iWarningCount = 0;
+    failingSite();
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 2);
+
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(dbgh::EAssertLevel::Warning, 2, dbgh::ECircuitAction::Escalate);
+    DummyExecutor::s_bTerminateCalled = false;
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_WARNING(2 * 3 == 4, "FAIL");
+    }
+    TEST_ASSERT(DummyExecutor::s_bTerminateCalled == true);
+
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(dbgh::EAssertLevel::Warning, 0);
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        failingSite();
+    }
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 100);
+
+#if ! defined(DBGH_ASSERTS_NO_ERROR) || defined(DEBUG)
+    dbgh::CAssertConfig::Get().EnableAsserts(IMPL_DBGH_VERIFY_LEVEL);
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(
+            IMPL_DBGH_VERIFY_LEVEL, 5, dbgh::ECircuitAction::Mute, std::chrono::milliseconds { 50 });
+    DummyExecutor::s_iVerifyCount = 0;
+    DummyExecutor::s_iWarningCount = 0;
+    int verifyFailures = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        verifyFailures += DBGH_VERIFY(2 * 3 == 4, "FAIL").has_value() ? 0 : 1;
+    }
+    TEST_ASSERT(verifyFailures == 100);
+    TEST_ASSERT(DummyExecutor::s_iVerifyCount == 5);
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 1);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("the site is muted for 50 ms"));
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(IMPL_DBGH_VERIFY_LEVEL, 0);
+#endif
+
+    std::cout << "End Circuit Breaker testing." << std::endl << std::endl;
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestScopedSuppress()
+{
+    std::cout << "Start Scoped Suppress testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Audit);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    DummyExecutor::s_iWarningCount = 0;
+    {
+        dbgh::CScopedSuppress suppress { dbgh::LevelMask(dbgh::EAssertLevel::Warning) };
+        ASSERT_WARNING(2 * 3 == 4, "FAIL");
+        TEST_ASSERT(! dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Warning));
+        TEST_ASSERT(dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Audit));
+        {
+            dbgh::CScopedSuppress nested { dbgh::LevelMask(dbgh::EAssertLevel::Warning, dbgh::EAssertLevel::Audit) };
+            TEST_ASSERT(! dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Audit));
+        }
+        TEST_ASSERT(dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Audit));
+        TEST_ASSERT(! dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Warning));
+
+        bool bOtherThreadActive = false;
+        std::thread { [&bOtherThreadActive]()
+        {
+            bOtherThreadActive = dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Warning);
+        } }.join();
+        TEST_ASSERT(bOtherThreadActive);
+    }
+#ifndef DEBUG
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 0);
+#endif
+    TEST_ASSERT(dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Warning));
+    ASSERT_WARNING(2 * 3 == 4, "FAIL");
+#ifndef DEBUG
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 1);
+#endif
+
+    std::cout << "End Scoped Suppress testing." << std::endl << std::endl;
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestChannels()
+{
+    std::cout << "Start Channels testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+    const auto defaultLevels = dbgh::CAssertConfig::Get().GetChannelLevels(dbgh::channels::storage);
+
+    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage, dbgh::LevelMask(dbgh::EAssertLevel::Fatal));
+    TEST_ASSERT(! dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::channels::storage, dbgh::EAssertLevel::Warning));
+    TEST_ASSERT(dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::channels::network, dbgh::EAssertLevel::Warning));
+    TEST_ASSERT(dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Warning));
+
+    DummyExecutor::s_iWarningCount = 0;
+    ASSERT_WARNING_CH(storage, 2 * 3 == 4, "FAIL");
+#ifndef DEBUG
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 0);
+#endif
+    ASSERT_WARNING_CH(network, 2 * 3 == 4, "FAIL");
+    ASSERT_WARNING(2 * 3 == 4, "FAIL");
+#ifndef DEBUG
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 2);
+
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_ONCE_CH(storage, i < 0, "FAIL {}", i);
+        ASSERT_FIRST_N_CH(network, 2, i < 0, "FAIL {}", i);
+    }
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 2);
+#endif
+
+    TEST_ASSERT(dbgh::CAssertConfig::Get().SetChannelLevels("network", dbgh::LevelMask()));
+    TEST_ASSERT(! dbgh::CAssertConfig::Get().SetChannelLevels("unknown", dbgh::LevelMask()));
+    TEST_ASSERT(! dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::channels::network, dbgh::EAssertLevel::Warning));
+    TEST_ASSERT(dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::EAssertLevel::Warning));
+
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    TEST_ASSERT(! dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::channels::network, dbgh::EAssertLevel::Warning));
+    TEST_ASSERT(dbgh::CAssertConfig::Get().GetChannelLevels(dbgh::channels::network) == dbgh::LevelMask());
+
+    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage, defaultLevels);
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Warning);
+    TEST_ASSERT(! dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::channels::storage, dbgh::EAssertLevel::Warning));
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    TEST_ASSERT(dbgh::CAssertConfig::Get().IsActiveAssert(dbgh::channels::storage, dbgh::EAssertLevel::Warning));
+
+    TEST_ASSERT(dbgh::CAssertConfig::Get().RegisterChannel(dbgh::channels::network));
+    TEST_ASSERT(! dbgh::CAssertConfig::Get().RegisterChannel(dbgh::SChannel { 2, "duplicate" }));
+    TEST_ASSERT(! dbgh::CAssertConfig::Get().SetChannelLevels("duplicate", dbgh::LevelMask()));
+
+    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage, defaultLevels);
+    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::network, defaultLevels);
+    std::cout << "End Channels testing." << std::endl << std::endl;
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
 void TestErrorAssert()
 {
     std::cout << "Start Error Assert testing." << std::endl;
@@ -118,12 +453,24 @@ void TestErrorAssert()
     DummyExecutor::s_bHandleErrorCalled = false;
     ASSERT_ERROR(2 * 2 == 4, "PASS");
     TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+#ifndef DBGH_ASSERTS_NO_ERROR
     ASSERT_ERROR(2 * 3 == 4, "FAIL");
     TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true);
     DummyExecutor::s_bHandleErrorCalled = false;
+#endif
     ASSERT_ERROR(2 * 2 == 4, "PASS");
     TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
 
+    // Until ASSERT_ERROR is compiled out, the assumed asserts are the ordinary asserts.
+    const std::vector<int> values(8);
+    ASSERT_ERROR_ASSUME(values.size() % 8 == 0, "PASS");
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+#ifndef DBGH_ASSERTS_NO_ERROR
+    ASSERT_ERROR_ASSUME(values.size() % 3 == 0, "FAIL");
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true);
+    DummyExecutor::s_bHandleErrorCalled = false;
+#endif
+
     dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Error);
     ASSERT_ERROR(2 * 2 == 4, "PASS");
     TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
@@ -135,12 +482,99 @@ void TestErrorAssert()
     dbgh::CAssertConfig::Get().SetExecutor();
 }
 
+constexpr int ParseDigits(const std::string_view text)
+{
+    int value = 0;
+    for (const auto c : text)
+    {
+        ASSERT_ERROR(c >= '0' && c <= '9', "The character {} is not a digit.", c);
+        ASSERT_WARNING(value < 100000, "The value {} is large.", value);
+        ASSERT_DEBUG(value >= 0, "The value {} is negative.", value);
+        ASSERT_AUDIT(value >= 0, "The value {} is negative.", value);
+        ASSERT_FATAL_SAFE(value >= 0, "The value is negative.");
+        value = value * 10 + (c - '0');
+    }
+    return value;
+}
+
+void TestConstexprAssert()
+{
+    std::cout << "Start Constexpr Assert testing." << std::endl;
+    static_assert(ParseDigits("2020") == 2020);
+
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+    DummyExecutor::s_bHandleErrorCalled = false;
+    TEST_ASSERT(ParseDigits(std::string { "42" }) == 42);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+#ifndef DBGH_ASSERTS_NO_ERROR
+    [[maybe_unused]] const auto value = ParseDigits(std::string { "4x" });
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true);
+    DummyExecutor::s_bHandleErrorCalled = false;
+#endif
+    std::cout << "End Constexpr Assert testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+dbgh::TVerified CheckPositive(const int value, int& result)
+{
+    DBGH_VERIFY_OR_RETURN(value > 0, "The value {} is not positive.", value);
+    result = value;
+    return { };
+}
+
+void TestVerify()
+{
+    std::cout << "Start Verify testing." << std::endl;
+    static_assert(sizeof(dbgh::TVerified) <= 2 * sizeof(void*));
+    dbgh::CAssertConfig::Get().EnableAsserts(IMPL_DBGH_VERIFY_LEVEL);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    int result = 0;
+    DummyExecutor::s_bHandleVerifyCalled = false;
+    TEST_ASSERT(CheckPositive(5, result).has_value());
+    TEST_ASSERT(result == 5);
+    TEST_ASSERT(DummyExecutor::s_bHandleVerifyCalled == false);
+    TEST_ASSERT(DBGH_VERIFY(2 * 2 == 4, "PASS").has_value());
+
+#if ! defined(DBGH_ASSERTS_NO_ERROR) || defined(DEBUG)
+    DummyExecutor::s_bHandleErrorCalled = false;
+    const auto failed = CheckPositive(-1, result);
+    TEST_ASSERT(! failed.has_value());
+    TEST_ASSERT(result == 5);
+    TEST_ASSERT(DummyExecutor::s_bHandleVerifyCalled == true);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("The value -1 is not positive."));
+    TEST_ASSERT(std::string_view { "value > 0" } == failed.error().Expression());
+    TEST_ASSERT(std::string_view { "CheckPositive" } == failed.error().Function());
+    TEST_ASSERT(IMPL_DBGH_VERIFY_LEVEL == failed.error().Level());
+    DummyExecutor::s_bHandleVerifyCalled = false;
+
+    const auto verified = DBGH_VERIFY(2 * 3 == 4, "FAIL");
+    TEST_ASSERT(! verified);
+    TEST_ASSERT(DummyExecutor::s_bHandleVerifyCalled == true);
+    TEST_ASSERT(verified.error().LineNumber() == __LINE__ - 3);
+    DummyExecutor::s_bHandleVerifyCalled = false;
+#endif
+
+    // The level of ASSERT_ERROR silences the verification, Debug in debug mode.
+    dbgh::CAssertConfig::Get().DisableAsserts(IMPL_DBGH_VERIFY_LEVEL);
+    TEST_ASSERT(CheckPositive(-1, result).has_value());
+    TEST_ASSERT(DummyExecutor::s_bHandleVerifyCalled == false);
+    dbgh::CAssertConfig::Get().EnableAsserts(IMPL_DBGH_VERIFY_LEVEL);
+    std::cout << "End Verify testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
 void TestDebugAssert()
 {
     std::cout << "Start Debug Assert testing." << std::endl;
     dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
     dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
 
+#ifndef DBGH_ASSERTS_NO_DEBUG
     constexpr int testCount = 100;
 
     DummyExecutor::s_cUserInput = 'i';
@@ -164,6 +598,7 @@ void TestDebugAssert()
     TEST_ASSERT(DummyExecutor::s_bTerminateCalled == false);
 
     DummyExecutor::s_cUserInput = 't';
+#ifdef DBGH_ASSERTS_EXCEPTIONS
     try
     {
         ASSERT_DEBUG(2 * 3 == 213, "FAIL");
@@ -173,12 +608,960 @@ void TestDebugAssert()
     {
         TEST_ASSERT(true);
     }
+#else
+    ASSERT_DEBUG(2 * 3 == 213, "FAIL");
+    TEST_ASSERT(DummyExecutor::s_bTerminateCalled == true);
+    DummyExecutor::s_bTerminateCalled = false;
+#endif
+#endif
 
     std::cout << "End Debug Assert testing." << std::endl << std::endl;
 
     dbgh::CAssertConfig::Get().SetExecutor();
 }
 
+void TestHeadlessDebugAssert()
+{
+    std::cout << "Start Headless Debug Assert testing." << std::endl;
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+#ifndef DBGH_ASSERTS_NO_DEBUG
+    DummyExecutor::s_bInteractive = false;
+    DummyExecutor::s_cUserInput = 'b';
+    DummyExecutor::s_bTerminateCalled = false;
+    dbgh::CAssertConfig::Get().SetHeadlessAction(dbgh::EAssertAction::Ignore);
+    ASSERT_DEBUG(2 * 3 == 213, "FAIL");
+    TEST_ASSERT(DummyExecutor::s_bTerminateCalled == false);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("DEBUG ASSERT"));
+
+    dbgh::CAssertConfig::Get().SetHeadlessAction(dbgh::EAssertAction::Throw);
+#ifdef DBGH_ASSERTS_EXCEPTIONS
+    try
+    {
+        ASSERT_DEBUG(2 * 3 == 213, "FAIL");
+        TEST_ASSERT(false);
+    }
+    catch ([[maybe_unused]] const dbgh::CAssertException& e)
+    {
+        TEST_ASSERT(true);
+    }
+#else
+    ASSERT_DEBUG(2 * 3 == 213, "FAIL");
+    TEST_ASSERT(DummyExecutor::s_bTerminateCalled == true);
+    DummyExecutor::s_bTerminateCalled = false;
+#endif
+
+    DummyExecutor::s_bInteractive = true;
+    DummyExecutor::s_bInputReady = false;
+    dbgh::CAssertConfig::Get().SetHeadlessAction(dbgh::EAssertAction::Ignore);
+    dbgh::CAssertConfig::Get().SetPromptTimeout(std::chrono::milliseconds { 10 });
+    ASSERT_DEBUG(2 * 3 == 213, "FAIL");
+    TEST_ASSERT(DummyExecutor::s_bTerminateCalled == false);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("Timeout"));
+#endif
+
+    DummyExecutor::s_bInputReady = true;
+    DummyExecutor::s_cUserInput = 'i';
+    dbgh::CAssertConfig::Get().SetPromptTimeout(std::chrono::milliseconds { 0 });
+    std::cout << "End Headless Debug Assert testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+#if ! defined(_WIN32) && ! defined(DBGH_ASSERTS_NO_DEBUG)
+class PipeExecutor : public dbgh::CHandlerExecutor
+{
+public:
+    void Logs([[maybe_unused]] std::string_view message) override
+    {
+    }
+
+    void ShowMessage(std::string_view message) override
+    {
+        s_strMessages += message;
+    }
+
+    bool IsInteractive() override
+    {
+        return true;
+    }
+
+    static inline std::string s_strMessages{};
+};
+
+std::size_t CountOf(const std::string& text, const std::string_view pattern)
+{
+    std::size_t count = 0;
+    for (auto pos = text.find(pattern); std::string::npos != pos; pos = text.find(pattern, pos + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+
+void TestPromptInput()
+{
+    std::cout << "Start Prompt Input testing." << std::endl;
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<PipeExecutor>());
+    dbgh::CAssertConfig::Get().SetPromptTimeout(std::chrono::seconds { 2 });
+    PipeExecutor::s_strMessages.clear();
+
+    int fds[2];
+    TEST_ASSERT(0 == ::pipe(fds));
+    const int savedStdin = ::dup(STDIN_FILENO);
+    ::dup2(fds[0], STDIN_FILENO);
+    constexpr std::string_view answers = "x\n  i\nf\n";
+    TEST_ASSERT(static_cast<ssize_t>(answers.size()) == ::write(fds[1], answers.data(), answers.size()));
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_DEBUG(2 * 3 == 213, "FAIL");
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ::dup2(savedStdin, STDIN_FILENO);
+    ::close(savedStdin);
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    TEST_ASSERT(elapsed < std::chrono::seconds { 1 });
+    TEST_ASSERT(std::string::npos == PipeExecutor::s_strMessages.find("Timeout"));
+    TEST_ASSERT(1 == CountOf(PipeExecutor::s_strMessages, "Invalid action"));
+    TEST_ASSERT(2 == CountOf(PipeExecutor::s_strMessages, "Press (I/i)"));
+
+    // The closed input applies the headless action, with and without the prompt timeout.
+    dbgh::CAssertConfig::Get().SetHeadlessAction(dbgh::EAssertAction::Ignore);
+    for (const auto timeout : { std::chrono::milliseconds { 2000 }, std::chrono::milliseconds { 0 } })
+    {
+        dbgh::CAssertConfig::Get().SetPromptTimeout(timeout);
+        PipeExecutor::s_strMessages.clear();
+        TEST_ASSERT(0 == ::pipe(fds));
+        ::close(fds[1]);
+        const int closedStdin = ::dup(STDIN_FILENO);
+        ::dup2(fds[0], STDIN_FILENO);
+        const auto closedStart = std::chrono::steady_clock::now();
+        ASSERT_DEBUG(2 * 3 == 213, "FAIL");
+        const auto closedElapsed = std::chrono::steady_clock::now() - closedStart;
+        ::dup2(closedStdin, STDIN_FILENO);
+        ::close(closedStdin);
+        ::close(fds[0]);
+
+        TEST_ASSERT(closedElapsed < std::chrono::seconds { 1 });
+        TEST_ASSERT(1 == CountOf(PipeExecutor::s_strMessages, "No input"));
+        TEST_ASSERT(0 == CountOf(PipeExecutor::s_strMessages, "Invalid action"));
+    }
+
+    dbgh::CAssertConfig::Get().SetPromptTimeout(std::chrono::milliseconds { 0 });
+    std::cout << "End Prompt Input testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+#endif
+
+void TestAuditAssert()
+{
+    std::cout << "Start Audit Assert testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Audit);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    constexpr int testCount = 100;
+    int evaluationCount = 0;
+    auto expensiveCheck = [&evaluationCount](bool result)
+    {
+        ++evaluationCount;
+        return result;
+    };
+    constexpr auto auditLine = __LINE__ + 3;
+    auto auditedCall = [&expensiveCheck]()
+    {
+        ASSERT_AUDIT(expensiveCheck(true), "PASS");
+    };
+
+    dbgh::CAssertConfig::Get().SetSamplingRate(dbgh::EAssertLevel::Audit, 10);
+    DummyExecutor::s_bHandleWarningCalled = false;
+    for (int i = 0; i < testCount; ++i)
+    {
+        auditedCall();
+    }
+    TEST_ASSERT(evaluationCount == testCount / 10);
+    TEST_ASSERT(DummyExecutor::s_bHandleWarningCalled == false);
+
+    TEST_ASSERT(dbgh::CAssertConfig::Get().SetSamplingRate(IMPL_DBGH_FILE, auditLine, 50) == 1);
+    evaluationCount = 0;
+    for (int i = 0; i < testCount; ++i)
+    {
+        auditedCall();
+    }
+    TEST_ASSERT(evaluationCount == testCount / 50);
+
+    ASSERT_AUDIT(expensiveCheck(false), "FAIL");
+    TEST_ASSERT(DummyExecutor::s_bHandleWarningCalled == true);
+
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Audit);
+    evaluationCount = 0;
+    DummyExecutor::s_bHandleWarningCalled = false;
+    ASSERT_AUDIT(expensiveCheck(false), "FAIL");
+    TEST_ASSERT(evaluationCount == 0);
+    TEST_ASSERT(DummyExecutor::s_bHandleWarningCalled == false);
+
+    dbgh::CAssertConfig::Get().SetSamplingRate(dbgh::EAssertLevel::Audit, 100);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Audit);
+    std::cout << "End Audit Assert testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestCpuGovernor()
+{
+    std::cout << "Start CPU Governor testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Audit);
+    dbgh::CAssertConfig::Get().SetSamplingRate(dbgh::EAssertLevel::Audit, 1);
+    dbgh::CAssertConfig::Get().SetCpuBudget(0.001, std::chrono::milliseconds { 10 });
+    TEST_ASSERT(dbgh::CAssertConfig::Get().GetCpuBudget() > 0.0);
+
+    std::vector<int> values(20000);
+    std::iota(std::begin(values), std::end(values), 0);
+    int expensiveCount = 0;
+    int cheapCount = 0;
+    auto expensiveCheck = [&values, &expensiveCount]()
+    {
+        ++expensiveCount;
+        return std::accumulate(std::begin(values), std::end(values), 0LL) > 0;
+    };
+    auto cheapCheck = [&cheapCount]()
+    {
+        ++cheapCount;
+        return true;
+    };
+    constexpr auto expensiveLine = __LINE__ + 3;
+    auto governedCall = [&expensiveCheck, &cheapCheck]()
+    {
+        ASSERT_AUDIT(expensiveCheck(), "PASS");
+        ASSERT_AUDIT(cheapCheck(), "PASS");
+    };
+
+    // The governor throttles the expensive site after the first windows, the machine load can delay it.
+    constexpr int testCount = 20000;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds { 10 };
+    do
+    {
+        expensiveCount = 0;
+        cheapCount = 0;
+        for (int i = 0; i < testCount; ++i)
+        {
+            governedCall();
+        }
+    } while (expensiveCount >= testCount / 10 && std::chrono::steady_clock::now() < deadline);
+    TEST_ASSERT(cheapCount == testCount);
+    TEST_ASSERT(expensiveCount < testCount / 10);
+
+    const auto governedRate = [expensiveLine]()
+    {
+        std::uint32_t rate = 0;
+        dbgh::impl::CSiteRegistry::ForEach("main.cpp", expensiveLine, [&rate](dbgh::impl::SAssertSite& site)
+        {
+            rate = site.m_uGovernedRate.load(std::memory_order_relaxed);
+        });
+        return rate;
+    };
+    TEST_ASSERT(governedRate() > 1);
+
+    // The throttled site which is not executed anymore is released window by window.
+    const auto relaxDeadline = std::chrono::steady_clock::now() + std::chrono::seconds { 10 };
+    do
+    {
+        for (int i = 0; i < testCount; ++i)
+        {
+            ASSERT_AUDIT(cheapCheck(), "PASS");
+        }
+    } while (0 != governedRate() && std::chrono::steady_clock::now() < relaxDeadline);
+    TEST_ASSERT(0 == governedRate());
+
+    dbgh::CAssertConfig::Get().SetCpuBudget(0.0);
+    TEST_ASSERT(dbgh::CAssertConfig::Get().GetCpuBudget() <= 0.0);
+
+    dbgh::CAssertConfig::Get().SetSamplingRate(dbgh::EAssertLevel::Audit, 100);
+    std::cout << "End CPU Governor testing." << std::endl << std::endl;
+}
+
+void TestRangeAsserts()
+{
+    std::cout << "Start Range Asserts testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    constexpr std::size_t bufferSize = 1000;
+
+    std::vector<float> floats(bufferSize, 0.5f);
+    std::vector<double> doubles(bufferSize, 0.5);
+    std::vector<std::int32_t> ints(bufferSize);
+    std::vector<std::int64_t> longs(bufferSize);
+    std::iota(std::begin(ints), std::end(ints), 0);
+    std::iota(std::begin(longs), std::end(longs), 0);
+    std::vector<const int*> pointers(bufferSize, &ints.front());
+
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_ALL_FINITE(floats);
+    ASSERT_ALL_FINITE(doubles);
+    ASSERT_IN_RANGE(floats, 0.0f, 1.0f);
+    ASSERT_IN_RANGE(doubles, 0.0, 1.0);
+    ASSERT_IN_RANGE(ints, 0, 999);
+    ASSERT_IN_RANGE(longs, 0, 999);
+    ASSERT_SORTED(ints);
+    ASSERT_SORTED(longs);
+    ASSERT_SORTED(floats);
+    ASSERT_NONE_NULL(pointers);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+
+#ifndef DBGH_ASSERTS_NO_ERROR
+    constexpr std::size_t failIndex = 937;
+    auto failedAt = [](std::size_t index)
+    {
+        const bool called = DummyExecutor::s_bHandleErrorCalled;
+        DummyExecutor::s_bHandleErrorCalled = false;
+        return called && std::string::npos != DummyExecutor::s_strMessage.find(std::format("index {} ", index));
+    };
+
+    floats[failIndex] = std::numeric_limits<float>::quiet_NaN();
+    ASSERT_ALL_FINITE(floats);
+    TEST_ASSERT(failedAt(failIndex));
+    doubles[failIndex] = std::numeric_limits<double>::infinity();
+    ASSERT_ALL_FINITE(doubles);
+    TEST_ASSERT(failedAt(failIndex));
+    ASSERT_IN_RANGE(doubles, 0.0, 1.0);
+    TEST_ASSERT(failedAt(failIndex));
+    ASSERT_IN_RANGE(ints, 0, 900);
+    TEST_ASSERT(failedAt(901));
+    ASSERT_IN_RANGE(longs, 5, 999);
+    TEST_ASSERT(failedAt(0));
+    ints[failIndex] = -1;
+    ASSERT_SORTED(ints);
+    TEST_ASSERT(failedAt(failIndex));
+    longs[failIndex + 1] = 0;
+    ASSERT_SORTED(longs);
+    TEST_ASSERT(failedAt(failIndex + 1));
+    pointers[failIndex] = nullptr;
+    ASSERT_NONE_NULL(pointers);
+    TEST_ASSERT(failedAt(failIndex));
+#endif
+
+    // The mixed bounds: the vectorized int32 and float kernels must give the answers of the scalar loop
+    // over the same values stored in the types without kernels.
+    std::vector<std::int32_t> vectorized(100);
+    std::iota(std::begin(vectorized), std::end(vectorized), 0);
+    const std::vector<std::int16_t> scalar(std::begin(vectorized), std::end(vectorized));
+    const auto compare = [&vectorized, &scalar](const auto lo, const auto hi, const std::size_t expected)
+    {
+        return expected == dbgh::impl::CRangeCheck::FindOutOfRange(vectorized, lo, hi)
+               && expected == dbgh::impl::CRangeCheck::FindOutOfRange(scalar, lo, hi);
+    };
+    TEST_ASSERT(compare(0, 10u, 11));
+    TEST_ASSERT(compare(0.5, 50, 0));
+    TEST_ASSERT(compare(0, 49.5, 50));
+    TEST_ASSERT(compare(-(std::int64_t { 1 } << 40), (std::int64_t { 1 } << 40) + 5, dbgh::impl::CRangeCheck::npos));
+    TEST_ASSERT(compare(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::uint64_t>::max()
+                        , dbgh::impl::CRangeCheck::npos));
+    TEST_ASSERT(compare(0, std::size_t { 98 }, 99));
+
+    const std::vector<float> vectorizedFloats(100, 0.1f);
+    const std::vector<long double> scalarFloats(std::begin(vectorizedFloats), std::end(vectorizedFloats));
+    TEST_ASSERT(0 == dbgh::impl::CRangeCheck::FindOutOfRange(vectorizedFloats, 0.0, 0.1)
+                && 0 == dbgh::impl::CRangeCheck::FindOutOfRange(scalarFloats, 0.0, 0.1));
+    TEST_ASSERT(dbgh::impl::CRangeCheck::npos == dbgh::impl::CRangeCheck::FindOutOfRange(vectorizedFloats, 0, 0.1f)
+                && dbgh::impl::CRangeCheck::npos == dbgh::impl::CRangeCheck::FindOutOfRange(scalarFloats, 0, 0.1f));
+
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Error);
+    ASSERT_NONE_NULL(pointers);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    std::cout << "End Range Asserts testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestParallelAssert()
+{
+    std::cout << "Start Parallel Assert testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+    dbgh::CAssertConfig::Get().SetParallelCheckThreads(4);
+
+    constexpr std::size_t bufferSize = 4 * 1024 * 1024;
+    std::vector<std::int32_t> values(bufferSize);
+    std::iota(std::begin(values), std::end(values), 0);
+
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_ALL_OF_PAR(values, [](std::int32_t value) { return value >= 0; });
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+
+    values[3 * 1024 * 1024] = -1;
+    values[1024 * 1024 + 7] = -1;
+#ifndef DBGH_ASSERTS_NO_ERROR
+    for (int i = 0; i < 10; ++i)
+    {
+        DummyExecutor::s_bHandleErrorCalled = false;
+        ASSERT_ALL_OF_PAR(values, [](std::int32_t value) { return value >= 0; });
+        TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true
+                    && std::string::npos != DummyExecutor::s_strMessage.find("index 1048583 "));
+    }
+
+    dbgh::CAssertConfig::Get().SetParallelCheckThreads(1);
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_ALL_OF_PAR(values, [](std::int32_t value) { return value >= 0; });
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true
+                && std::string::npos != DummyExecutor::s_strMessage.find("index 1048583 "));
+#endif
+
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Error);
+    int predicateCalls = 0;
+    ASSERT_ALL_OF_PAR(values, [&predicateCalls](std::int32_t) { return 0 == ++predicateCalls; });
+    TEST_ASSERT(0 == predicateCalls);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    dbgh::CAssertConfig::Get().SetParallelCheckThreads(0);
+    std::cout << "End Parallel Assert testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestPointerAsserts()
+{
+    std::cout << "Start Pointer Asserts testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    int value = 42;
+    std::vector<double> values(1024);
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_VALID_PTR(&value);
+    ASSERT_READABLE(values.data(), values.size() * sizeof(double));
+    ASSERT_VALID_PTR("literal");
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+
+    const int* pNull = nullptr;
+#ifndef DBGH_ASSERTS_NO_ERROR
+    ASSERT_VALID_PTR(pNull);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true
+                && std::string::npos != DummyExecutor::s_strMessage.find("is not mapped"));
+#endif
+
+#ifdef __linux__
+    const auto pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    auto* pPages = static_cast<char*>(::mmap(nullptr, 3 * pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    TEST_ASSERT(MAP_FAILED != pPages);
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_READABLE(pPages, 3 * pageSize);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+
+    ::mprotect(pPages + pageSize, pageSize, PROT_NONE);
+    ::munmap(pPages + 2 * pageSize, pageSize);
+    dbgh::impl::CAddressMap::Refresh();
+    ASSERT_VALID_PTR(pPages);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+#ifndef DBGH_ASSERTS_NO_ERROR
+    ASSERT_VALID_PTR(pPages + pageSize);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true);
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_VALID_PTR(pPages + 2 * pageSize);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true);
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_READABLE(pPages, 2 * pageSize);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true
+                && std::string::npos != DummyExecutor::s_strMessage.find("are not readable"));
+#endif
+    ::munmap(pPages, 2 * pageSize);
+#endif
+
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Error);
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_VALID_PTR(pNull);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    std::cout << "End Pointer Asserts testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+constexpr int SumChecked()
+{
+    std::array<int, 4> values { 1, 2, 3, 4 };
+    const dbgh::CCheckedSpan span { values };
+    int sum = span[0];
+    span.subspan_checked(1).for_each_checked([&sum](const int value) { sum += value; });
+    return sum;
+}
+
+void TestCheckedSpan()
+{
+    std::cout << "Start Checked Span testing." << std::endl;
+    static_assert(SumChecked() == 10);
+    static_assert(sizeof(dbgh::checked_span<int>) == sizeof(std::span<int>));
+    static_assert(std::is_trivially_copyable_v<dbgh::checked_span<const int, dbgh::EAssertLevel::Warning>>);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    std::vector<int> values(16);
+    std::iota(std::begin(values), std::end(values), 0);
+    const dbgh::checked_span<int> span { values };
+    DummyExecutor::s_bHandleErrorCalled = false;
+    TEST_ASSERT(15 == span[15] && 0 == span.front() && 15 == span.back());
+    int sum = 0;
+    span.for_each_checked(4, 8, [&sum](const int value) { sum += value; });
+    TEST_ASSERT(4 + 5 + 6 + 7 == sum);
+    TEST_ASSERT(4 == span.subspan_checked(12).size() && 12 == span.subspan_checked(12, 2)[0]);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+
+#ifndef DBGH_ASSERTS_NO_ERROR
+    [[maybe_unused]] const auto outside = span.subspan_checked(10, 8);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true
+                && std::string::npos != DummyExecutor::s_strMessage.find("subspan at 10 of 8 elements"));
+    DummyExecutor::s_bHandleErrorCalled = false;
+    span.for_each_checked(8, 4, [](int&) { });
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true
+                && std::string::npos != DummyExecutor::s_strMessage.find("range [8, 4)"));
+#endif
+
+    DummyExecutor::s_iWarningCount = 0;
+    const dbgh::checked_span<const int, dbgh::EAssertLevel::Warning> empty { };
+    empty.for_each_checked(2, 1, [](const int) { });
+    [[maybe_unused]] const auto emptySubspan = empty.subspan_checked(1);
+    TEST_ASSERT(2 == DummyExecutor::s_iWarningCount);
+
+    dbgh::CCheckedVectorView view { values };
+    values.push_back(16);
+    DummyExecutor::s_bHandleErrorCalled = false;
+    TEST_ASSERT(16 == view[16] && 17 == view.size());
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+#ifndef DBGH_ASSERTS_NO_ERROR
+    [[maybe_unused]] const auto subspan = view.subspan_checked(17, 1);
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true
+                && std::string::npos != DummyExecutor::s_strMessage.find("of size 17"));
+#endif
+
+    const std::vector<int>& constValues = values;
+    const dbgh::checked_vector_view<const int> constView { constValues };
+    TEST_ASSERT(16 == constView.back());
+
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Error);
+    DummyExecutor::s_bHandleErrorCalled = false;
+    view.for_each_checked(8, 4, [](int&) { });
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    std::cout << "End Checked Span testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+struct SPageHeader
+{
+    std::uint32_t m_uMagic;
+    std::uint32_t m_uChecksum;
+};
+
+bool IsValidHeader(const SPageHeader& header)
+{
+    return 0xDB6u == header.m_uMagic && (header.m_uMagic ^ 0xFFFFu) == header.m_uChecksum;
+}
+
+void TestDeferredAssert()
+{
+    std::cout << "Start Deferred Assert testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Error);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    SPageHeader header { 0xDB6u, 0xDB6u ^ 0xFFFFu };
+
+    DummyExecutor::s_bHandleWarningCalled = false;
+    DummyExecutor::s_bHandleErrorCalled = false;
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_DEFERRED(dbgh::EAssertLevel::Warning, header, IsValidHeader, "PASS {}", i);
+    }
+    dbgh::CDeferredVerifier::Flush();
+    TEST_ASSERT(DummyExecutor::s_bHandleWarningCalled == false);
+
+    header.m_uChecksum = 0;
+    ASSERT_DEFERRED(dbgh::EAssertLevel::Error, header, IsValidHeader, "_Page: {}", 42);
+    dbgh::CDeferredVerifier::Flush();
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("_Page: 42"));
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find(std::to_string(__LINE__ - 4)));
+
+#ifndef DEBUG
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(
+            dbgh::EAssertLevel::Warning, 5, dbgh::ECircuitAction::Mute, std::chrono::seconds { 1 });
+    DummyExecutor::s_iWarningCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_DEFERRED(dbgh::EAssertLevel::Warning, header, IsValidHeader, "FAIL {}", i);
+    }
+    dbgh::CDeferredVerifier::Flush();
+    TEST_ASSERT(DummyExecutor::s_iWarningCount == 6);
+    dbgh::CAssertConfig::Get().SetCircuitBreaker(dbgh::EAssertLevel::Warning, 0);
+#endif
+
+    dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Warning);
+    DummyExecutor::s_bHandleWarningCalled = false;
+    ASSERT_DEFERRED(dbgh::EAssertLevel::Warning, header, IsValidHeader, "FAIL");
+    dbgh::CDeferredVerifier::Flush();
+    TEST_ASSERT(DummyExecutor::s_bHandleWarningCalled == false);
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    TEST_ASSERT(0 == dbgh::CDeferredVerifier::GetDroppedCount());
+
+    const auto defaultLevels = dbgh::CAssertConfig::Get().GetChannelLevels(dbgh::channels::storage);
+    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage, dbgh::LevelMask());
+    DummyExecutor::s_bHandleErrorCalled = false;
+    ASSERT_DEFERRED_CH(storage, dbgh::EAssertLevel::Error, header, IsValidHeader, "FAIL");
+    dbgh::CDeferredVerifier::Flush();
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == false);
+    dbgh::CAssertConfig::Get().SetChannelLevels(dbgh::channels::storage, defaultLevels);
+    ASSERT_DEFERRED_CH(storage, dbgh::EAssertLevel::Error, header, IsValidHeader, "_Storage page: {}", 7);
+    dbgh::CDeferredVerifier::Flush();
+    TEST_ASSERT(DummyExecutor::s_bHandleErrorCalled == true);
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("_Storage page: 7"));
+
+#ifdef DBGH_ASSERTS_EXCEPTIONS
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<ThrowingExecutor>());
+    DummyExecutor::s_strMessage.clear();
+    ASSERT_DEFERRED(dbgh::EAssertLevel::Warning, header, IsValidHeader, "FAIL");
+    dbgh::CDeferredVerifier::Flush();
+    TEST_ASSERT(DummyExecutor::s_strMessage == "The deferred assert is failed with an unknown exception.");
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+#endif
+    std::cout << "End Deferred Assert testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestAssertContext()
+{
+    std::cout << "Start Assert Context testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+
+    {
+        DBGH_CONTEXT("shard", 17);
+        {
+            DBGH_CONTEXT("request", "get_user");
+            ASSERT_WARNING(2 * 3 == 4, "FAIL");
+            TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("shard = 17"));
+            TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("request = get_user"));
+        }
+        ASSERT_WARNING(2 * 3 == 4, "FAIL");
+        TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("shard = 17"));
+        TEST_ASSERT(std::string::npos == DummyExecutor::s_strMessage.find("request"));
+    }
+    ASSERT_WARNING(2 * 3 == 4, "FAIL");
+    TEST_ASSERT(std::string::npos == DummyExecutor::s_strMessage.find("[context]"));
+    std::cout << "End Assert Context testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestFailureLatency()
+{
+    std::cout << "Start Failure Latency testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+    dbgh::CFailureLatency::Reset();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_WARNING(i < 0, "The index {} is not negative.", i);
+        ASSERT_WARNING(i >= 0, "PASS");
+    }
+    const auto format = dbgh::CFailureLatency::GetSummary(dbgh::EAssertLevel::Warning, dbgh::EFailurePhase::Format);
+    const auto executor = dbgh::CFailureLatency::GetSummary(dbgh::EAssertLevel::Warning, dbgh::EFailurePhase::Executor);
+    const auto output = dbgh::CFailureLatency::GetSummary(dbgh::EAssertLevel::Warning, dbgh::EFailurePhase::Output);
+    TEST_ASSERT(10 == format.m_uCount);
+    TEST_ASSERT(10 == executor.m_uCount);
+    TEST_ASSERT(0 == output.m_uCount);
+    TEST_ASSERT(format.m_uP50 <= format.m_uP90 && format.m_uP90 <= format.m_uP99 && format.m_uP99 <= format.m_uP999);
+    TEST_ASSERT(0 < format.m_uMax);
+
+    dbgh::CFailureLatency::Reset();
+    TEST_ASSERT(0 == dbgh::CFailureLatency::GetSummary(dbgh::EAssertLevel::Warning, dbgh::EFailurePhase::Format).m_uCount);
+    std::cout << "End Failure Latency testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+
+void TestAssertProfiler()
+{
+    std::cout << "Start Assert Profiler testing." << std::endl;
+    static constinit dbgh::impl::SProfileSite site { dbgh::EAssertLevel::Error, "ExpensiveCheck()", __FILE__, __LINE__ };
+    dbgh::CAssertProfiler::Reset();
+
+    std::vector<int> values(1000);
+    std::iota(std::begin(values), std::end(values), 0);
+    bool bResult = true;
+    for (int i = 0; i < 5; ++i)
+    {
+        bResult = dbgh::CAssertProfiler::Evaluate(site, __func__, [&values]()
+        {
+            return std::accumulate(std::begin(values), std::end(values), 0LL) > 0;
+        }) && bResult;
+    }
+    TEST_ASSERT(bResult);
+    TEST_ASSERT(5 == site.m_uEvaluations);
+    TEST_ASSERT(false == dbgh::CAssertProfiler::Evaluate(site, __func__, []() { return false; }));
+
+    std::ostringstream report;
+    dbgh::CAssertProfiler::Report(report, 5);
+    TEST_ASSERT(std::string::npos != report.str().find("Top sites by total cost:"));
+    TEST_ASSERT(std::string::npos != report.str().find("TestAssertProfiler: ExpensiveCheck()"));
+
+    dbgh::CAssertProfiler::Reset();
+    TEST_ASSERT(0 == site.m_uEvaluations);
+    std::cout << "End Assert Profiler testing." << std::endl << std::endl;
+}
+
+#ifndef _WIN32
+template <typename TCallable>
+std::pair<int, std::string> RunInChildProcess(const TCallable& callable)
+{
+    int arrPipe[2];
+    if (0 != pipe(arrPipe))
+    {
+        return { -1, { } };
+    }
+    std::cout.flush();
+    const auto pid = fork();
+    if (0 == pid)
+    {
+        close(arrPipe[0]);
+        callable(arrPipe[1]);
+        _exit(0);
+    }
+    close(arrPipe[1]);
+    std::string output;
+    char buffer[256];
+    for (ssize_t size; (size = read(arrPipe[0], buffer, sizeof(buffer))) > 0;)
+    {
+        output.append(buffer, static_cast<std::size_t>(size));
+    }
+    close(arrPipe[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return { status, output };
+}
+
+void TestSafeFatalAssert()
+{
+    std::cout << "Start Safe Fatal Assert testing." << std::endl;
+
+    auto [status, output] = RunInChildProcess([](const int descriptor)
+    {
+        dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Fatal);
+        dbgh::CAssertConfig::Get().SetFatalDescriptor(descriptor);
+        DBGH_CONTEXT("shard", -17);
+        ASSERT_FATAL_SAFE(2 * 2 == 4, "PASS");
+        ASSERT_FATAL_SAFE(2 * 3 == 4, "The header is corrupted.");
+    });
+    TEST_ASSERT(WIFSIGNALED(status) && SIGABRT == WTERMSIG(status));
+    TEST_ASSERT(std::string::npos != output.find("FATAL ASSERT:"));
+    TEST_ASSERT(std::string::npos != output.find("2 * 3 == 4"));
+    TEST_ASSERT(std::string::npos != output.find("The header is corrupted."));
+    TEST_ASSERT(std::string::npos != output.find("shard = -17"));
+
+    std::tie(status, output) = RunInChildProcess([](const int descriptor)
+    {
+        dbgh::CAssertConfig::Get().DisableAsserts(dbgh::EAssertLevel::Fatal);
+        dbgh::CAssertConfig::Get().SetFatalDescriptor(descriptor);
+        ASSERT_FATAL_SAFE(2 * 3 == 4, "FAIL");
+    });
+    TEST_ASSERT(WIFEXITED(status) && 0 == WEXITSTATUS(status));
+    TEST_ASSERT(output.empty());
+
+#ifndef DEBUG
+    std::tie(status, output) = RunInChildProcess([](const int descriptor)
+    {
+        dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Fatal);
+        dbgh::CAssertConfig::Get().SetFatalDescriptor(descriptor);
+        ASSERT_FATAL(2 * 3 == 4, "The size is {}.", 42);
+    });
+    TEST_ASSERT(WIFSIGNALED(status) && SIGABRT == WTERMSIG(status));
+    TEST_ASSERT(std::string::npos != output.find("The size is 42."));
+#endif
+
+    std::cout << "End Safe Fatal Assert testing." << std::endl << std::endl;
+}
+
+volatile int s_iMaxDepth = std::numeric_limits<int>::max();
+
+int OverflowStack(const int depth)
+{
+    volatile char arrFrame[1024];
+    arrFrame[0] = static_cast<char>(depth);
+    if (depth >= s_iMaxDepth)
+    {
+        return depth;
+    }
+    return OverflowStack(depth + 1) + arrFrame[0];
+}
+
+void TestCrashHandlers()
+{
+    std::cout << "Start Crash Handlers testing." << std::endl;
+
+    const auto [status, output] = RunInChildProcess([](const int descriptor)
+    {
+        dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+        dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+        ASSERT_WARNING(2 * 3 == 4, "The first failure {}.", 1);
+        ASSERT_WARNING(2 * 3 == 5, "The second failure {}.", 2);
+        if (! dbgh::CAssertConfig::Get().InstallCrashHandlers(descriptor))
+        {
+            return;
+        }
+        DBGH_CONTEXT("request", 77u);
+        std::raise(SIGSEGV);
+    });
+    TEST_ASSERT(WIFSIGNALED(status) && SIGSEGV == WTERMSIG(status));
+    TEST_ASSERT(std::string::npos != output.find("CRASH: SIGSEGV"));
+    TEST_ASSERT(std::string::npos != output.find("The first failure 1."));
+    TEST_ASSERT(std::string::npos != output.find("2 * 3 == 5 - The second failure 2."));
+    TEST_ASSERT(std::string::npos != output.find("request = 77"));
+
+    // The stack overflow of another thread is dumped on its own alternate stack.
+    const auto [overflowStatus, overflowOutput] = RunInChildProcess([](const int descriptor)
+    {
+        if (! dbgh::CAssertConfig::Get().InstallCrashHandlers(descriptor))
+        {
+            return;
+        }
+        std::thread { []()
+        {
+            if (dbgh::CAssertConfig::Get().InstallCrashHandlersForThread())
+            {
+                [[maybe_unused]] const auto depth = OverflowStack(0);
+            }
+        } }.join();
+    });
+    TEST_ASSERT(WIFSIGNALED(overflowStatus) && SIGSEGV == WTERMSIG(overflowStatus));
+    TEST_ASSERT(std::string::npos != overflowOutput.find("CRASH: SIGSEGV"));
+
+    std::cout << "End Crash Handlers testing." << std::endl << std::endl;
+}
+
+void TestChannelCollision()
+{
+    std::cout << "Start Channel Collision testing." << std::endl;
+
+    auto [status, output] = RunInChildProcess([](const int descriptor)
+    {
+        dbgh::CAssertConfig::Get().SetFatalDescriptor(descriptor);
+        [[maybe_unused]] const auto declared = dbgh::CAssertConfig::Get().DeclareChannel(dbgh::channels::storage);
+    });
+    TEST_ASSERT(WIFEXITED(status) && 0 == WEXITSTATUS(status));
+    TEST_ASSERT(output.empty());
+
+    std::tie(status, output) = RunInChildProcess([](const int descriptor)
+    {
+        dbgh::CAssertConfig::Get().SetFatalDescriptor(descriptor);
+        [[maybe_unused]] const auto declared = dbgh::CAssertConfig::Get().DeclareChannel(
+                dbgh::SChannel { dbgh::channels::network.m_uIndex, "duplicate" });
+    });
+    TEST_ASSERT(WIFSIGNALED(status) && SIGABRT == WTERMSIG(status));
+    TEST_ASSERT(std::string::npos != output.find("the channels network and duplicate have the same index 2."));
+
+    std::cout << "End Channel Collision testing." << std::endl << std::endl;
+}
+
+void TestSharedStatistics()
+{
+    std::cout << "Start Shared Statistics testing." << std::endl;
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+    TEST_ASSERT(dbgh::CAssertConfig::Get().EnableSharedStatistics());
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_WARNING(i < 0 && "shared statistics", "The index {} is not negative.", i);
+    }
+
+    const auto name = "/dbgh." + std::to_string(getpid());
+    const int descriptor = shm_open(name.c_str(), O_RDONLY, 0);
+    TEST_ASSERT(0 <= descriptor);
+    void* memory = mmap(nullptr, sizeof(dbgh::impl::SSharedStats), PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    TEST_ASSERT(MAP_FAILED != memory);
+    if (MAP_FAILED != memory)
+    {
+        const auto& stats = *static_cast<const dbgh::impl::SSharedStats*>(memory);
+        TEST_ASSERT(dbgh::impl::SSharedStats::s_uMagic == stats.m_uMagic);
+        TEST_ASSERT(3 <= stats.m_arrLevelFailures[static_cast<std::size_t>(dbgh::EAssertLevel::Warning)]);
+        std::uint64_t failures = 0;
+        for (const auto& site : stats.m_arrSites)
+        {
+            if (2 == site.m_uSequence && std::string_view { site.m_arrExpression }.ends_with("\"shared statistics\""))
+            {
+                failures = site.m_uFailures;
+                TEST_ASSERT(std::string_view { site.m_arrFunction } == "TestSharedStatistics");
+            }
+        }
+        TEST_ASSERT(3 == failures);
+        munmap(memory, sizeof(dbgh::impl::SSharedStats));
+    }
+
+    dbgh::CAssertConfig::Get().DisableSharedStatistics();
+    TEST_ASSERT(shm_open(name.c_str(), O_RDONLY, 0) < 0);
+
+    TEST_ASSERT(dbgh::CAssertConfig::Get().EnableSharedStatistics());
+    const int reopened = shm_open(name.c_str(), O_RDONLY, 0);
+    TEST_ASSERT(0 <= reopened);
+    struct stat status { };
+    TEST_ASSERT(0 == fstat(reopened, &status));
+    TEST_ASSERT(0600 == (status.st_mode & 0777));
+    close(reopened);
+#ifdef __linux__
+    std::ifstream maps { "/proc/self/maps" };
+    int mappings = 0;
+    for (std::string line; std::getline(maps, line);)
+    {
+        mappings += std::string::npos != line.find(name) ? 1 : 0;
+    }
+    TEST_ASSERT(1 == mappings);
+#endif
+    dbgh::CAssertConfig::Get().DisableSharedStatistics();
+
+    // The stale segment readable and writable by others is replaced.
+    const int stale = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+    TEST_ASSERT(0 <= stale);
+    TEST_ASSERT(0 == fchmod(stale, 0666));
+    TEST_ASSERT(0 == ftruncate(stale, static_cast<off_t>(sizeof(dbgh::impl::SSharedStats))));
+    void* staleMemory = mmap(nullptr, sizeof(dbgh::impl::SSharedStats), PROT_READ | PROT_WRITE, MAP_SHARED, stale, 0);
+    TEST_ASSERT(MAP_FAILED != staleMemory);
+    const bool replacedStale = dbgh::CAssertConfig::Get().EnableSharedStatistics();
+    TEST_ASSERT(replacedStale);
+    if (replacedStale)
+    {
+        const int replaced = shm_open(name.c_str(), O_RDONLY, 0);
+        TEST_ASSERT(0 <= replaced);
+        TEST_ASSERT(0 == fstat(replaced, &status));
+        TEST_ASSERT(0600 == (status.st_mode & 0777));
+        close(replaced);
+        ASSERT_WARNING(false && "stale segment", "The failure is not visible in the stale segment.");
+        if (MAP_FAILED != staleMemory)
+        {
+            const auto& staleStats = *static_cast<const dbgh::impl::SSharedStats*>(staleMemory);
+            TEST_ASSERT(0 == staleStats.m_arrLevelFailures[static_cast<std::size_t>(dbgh::EAssertLevel::Warning)]);
+        }
+    }
+    if (MAP_FAILED != staleMemory)
+    {
+        munmap(staleMemory, sizeof(dbgh::impl::SSharedStats));
+    }
+    close(stale);
+    dbgh::CAssertConfig::Get().DisableSharedStatistics();
+    std::cout << "End Shared Statistics testing." << std::endl << std::endl;
+
+    dbgh::CAssertConfig::Get().SetExecutor();
+}
+#endif
+
 void TestTextFormating()
 {
     std::cout << "Start text format testing." << std::endl;
@@ -202,13 +1585,76 @@ void TestTextFormating()
     std::cout << "End text format testing." << std::endl;
 }
 
+template <dbgh::impl::SFixedText TText>
+bool RoundTrip()
+{
+    const auto* compressed = dbgh::impl::SCompressedText<TText>::s_arrData.data();
+    char buffer[256];
+    return dbgh::impl::CExpressionText::IsCompressed(compressed)
+           && TText.View() == dbgh::impl::CExpressionText::Decode(compressed)
+           && TText.View() == dbgh::impl::CExpressionText::Decode(compressed, buffer, sizeof(buffer));
+}
+
+void TestExpressionText()
+{
+    std::cout << "Start expression text testing." << std::endl;
+    TEST_ASSERT(RoundTrip<"">());
+    TEST_ASSERT(RoundTrip<"nullptr != m_pSite && m_pSite->m_iLine >= 0">());
+    TEST_ASSERT(RoundTrip<"index < values.size() || std::empty(values)">());
+    TEST_ASSERT(RoundTrip<"text == \"\x01\xff\x80\"">());
+    TEST_ASSERT(sizeof(dbgh::impl::SCompressedText<"static_cast<int>(count) <= capacity">::s_arrData)
+                < sizeof("static_cast<int>(count) <= capacity"));
+
+    char buffer[8];
+    TEST_ASSERT(std::string_view { "index <" }
+                == dbgh::impl::CExpressionText::Decode(
+                        dbgh::impl::SCompressedText<"index < size">::s_arrData.data(), buffer, sizeof(buffer)));
+    TEST_ASSERT(std::string_view { "a < b" } == dbgh::impl::CExpressionText::Decode("a < b"));
+
+    dbgh::CAssertConfig::Get().EnableAsserts(dbgh::EAssertLevel::Warning);
+    dbgh::CAssertConfig::Get().SetExecutor(std::make_unique<DummyExecutor>());
+    ASSERT_WARNING(2 * 3 == 4, "_Text");
+    TEST_ASSERT(std::string::npos != DummyExecutor::s_strMessage.find("[expression]:   2 * 3 == 4\n"));
+    dbgh::CAssertConfig::Get().SetExecutor();
+
+    std::cout << "End expression text testing." << std::endl;
+}
+
 int main()
 {
     TestFatalAssert();
     TestWarningAssert();
+    TestLimitedAssert();
+    TestPeriodicAssert();
+    TestCircuitBreaker();
+    TestScopedSuppress();
+    TestChannels();
     TestErrorAssert();
+    TestConstexprAssert();
+    TestVerify();
     TestDebugAssert();
+    TestHeadlessDebugAssert();
+#if ! defined(_WIN32) && ! defined(DBGH_ASSERTS_NO_DEBUG)
+    TestPromptInput();
+#endif
+    TestAuditAssert();
+    TestCpuGovernor();
+    TestRangeAsserts();
+    TestParallelAssert();
+    TestPointerAsserts();
+    TestCheckedSpan();
+    TestDeferredAssert();
+    TestAssertContext();
+    TestFailureLatency();
+    TestAssertProfiler();
+#ifndef _WIN32
+    TestSafeFatalAssert();
+    TestCrashHandlers();
+    TestChannelCollision();
+    TestSharedStatistics();
+#endif
     TestTextFormating();
+    TestExpressionText();
     std::cout << "__END_OF_TESTING__" << std::endl;
     return 0;
 }
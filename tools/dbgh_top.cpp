@@ -0,0 +1,285 @@
+/**
+ * @file        dbgh_top.cpp
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       The viewer of the shared-memory failure statistics of a live process.
+ * @date        18-10-2026
+ * @copyright   Copyright (c) 2020
+ *
+ * @details     Usage: dbgh_top <pid> [interval ms] [iterations]
+ *              Maps /dev/shm/dbgh.<pid> read-only and prints the failures per level and the top failing sites
+ *              with their rates. The process must call dbgh::CAssertConfig::Get().EnableSharedStatistics().
+ *              The segment is remapped when the process is restarted with the same pid and publishes a new one.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "impl/SSharedStats.h"
+
+namespace
+{
+
+using dbgh::impl::SSharedSiteStats;
+using dbgh::impl::SSharedStats;
+
+constexpr std::size_t s_uTopCount = 20;
+
+constexpr const char* s_arrLevels[] { "WARNING", "DEBUG", "ERROR", "FATAL", "AUDIT" };
+
+struct SSite
+{
+    std::uint64_t m_uKey;
+    std::uint32_t m_uLevel;
+    std::int32_t m_iLine;
+    std::uint64_t m_uFailures;
+    double m_dRate;
+    std::string m_strFile;
+    std::string m_strFunction;
+    std::string m_strExpression;
+};
+
+[[nodiscard]] const char* LevelName(const std::uint32_t level)
+{
+    return level < std::size(s_arrLevels) ? s_arrLevels[level] : "UNKNOWN";
+}
+
+/**
+ * @brief      Copies the site under its sequence, returns false if the site is being written.
+ */
+[[nodiscard]] bool ReadSite(const SSharedSiteStats& shared, SSite& site)
+{
+    const auto key = shared.m_uKey.load(std::memory_order_acquire);
+    if (0 == key)
+    {
+        return false;
+    }
+    for (int attempt = 0; attempt < 4; ++attempt)
+    {
+        const auto before = shared.m_uSequence.load(std::memory_order_acquire);
+        if (0 == before || 0 != (before & 1))
+        {
+            continue;
+        }
+        char arrFile[SSharedSiteStats::s_uFileSize];
+        char arrFunction[SSharedSiteStats::s_uFunctionSize];
+        char arrExpression[SSharedSiteStats::s_uExpressionSize];
+        std::memcpy(arrFile, shared.m_arrFile, sizeof(arrFile));
+        std::memcpy(arrFunction, shared.m_arrFunction, sizeof(arrFunction));
+        std::memcpy(arrExpression, shared.m_arrExpression, sizeof(arrExpression));
+        site.m_uLevel = shared.m_uLevel;
+        site.m_iLine = shared.m_iLine;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (before != shared.m_uSequence.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+        arrFile[sizeof(arrFile) - 1] = '\0';
+        arrFunction[sizeof(arrFunction) - 1] = '\0';
+        arrExpression[sizeof(arrExpression) - 1] = '\0';
+        site.m_uKey = key;
+        site.m_uFailures = shared.m_uFailures.load(std::memory_order_relaxed);
+        site.m_strFile = arrFile;
+        site.m_strFunction = arrFunction;
+        site.m_strExpression = arrExpression;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @class      CSegment
+ * @brief      The read-only mapping of the segment, with the identity of the file it maps.
+ */
+class CSegment
+{
+public:
+    CSegment() = default;
+
+    ~CSegment()
+    {
+        Unmap();
+    }
+
+    CSegment(CSegment&&) noexcept = delete;
+
+    CSegment(const CSegment&) = delete;
+
+    CSegment& operator=(CSegment&&) = delete;
+
+    CSegment& operator=(const CSegment&) = delete;
+
+    /**
+     * @brief      Maps the segment if the name refers to another file than the mapped one, the restarted writer
+     *              unlinks the old segment and creates a new one. The old mapping is kept if the name is not opened.
+     *
+     * @return     True if a new segment is mapped, False otherwise.
+     */
+    [[nodiscard]] bool Remap(const std::string& name)
+    {
+        const int descriptor = shm_open(name.c_str(), O_RDONLY, 0);
+        if (descriptor < 0)
+        {
+            return false;
+        }
+        struct stat status { };
+        if (0 != fstat(descriptor, &status)
+            || (nullptr != m_pStats && status.st_dev == m_uDevice && status.st_ino == m_uInode)
+            || static_cast<std::size_t>(status.st_size) < sizeof(SSharedStats))
+        {
+            close(descriptor);
+            return false;
+        }
+        void* memory = mmap(nullptr, sizeof(SSharedStats), PROT_READ, MAP_SHARED, descriptor, 0);
+        close(descriptor);
+        if (MAP_FAILED == memory)
+        {
+            return false;
+        }
+        Unmap();
+        m_pStats = static_cast<const SSharedStats*>(memory);
+        m_uDevice = status.st_dev;
+        m_uInode = status.st_ino;
+        return true;
+    }
+
+    [[nodiscard]] const SSharedStats* Get() const noexcept
+    {
+        return m_pStats;
+    }
+
+private:
+    void Unmap() noexcept
+    {
+        if (nullptr != m_pStats)
+        {
+            munmap(const_cast<SSharedStats*>(m_pStats), sizeof(SSharedStats));
+            m_pStats = nullptr;
+        }
+    }
+
+    const SSharedStats* m_pStats = nullptr;
+    dev_t m_uDevice = 0;
+    ino_t m_uInode = 0;
+};
+
+[[nodiscard]] bool IsSupported(const SSharedStats& stats)
+{
+    return SSharedStats::s_uMagic == stats.m_uMagic && SSharedStats::s_uVersion == stats.m_uVersion;
+}
+
+void Print(const SSharedStats& stats, std::vector<SSite>& sites, const bool bClear)
+{
+    if (bClear)
+    {
+        std::cout << "\033[H\033[2J";
+    }
+    std::cout << "dbgh_top - pid " << stats.m_uPid << ", dropped sites: "
+              << stats.m_uDroppedSites.load(std::memory_order_relaxed) << std::endl;
+    for (std::size_t level = 0; level < std::size(s_arrLevels); ++level)
+    {
+        std::cout << std::left << std::setw(10) << s_arrLevels[level]
+                  << stats.m_arrLevelFailures[level].load(std::memory_order_relaxed) << std::endl;
+    }
+    std::cout << std::endl;
+
+    std::sort(std::begin(sites), std::end(sites), [](const SSite& lhs, const SSite& rhs)
+    {
+        if (lhs.m_dRate > rhs.m_dRate || rhs.m_dRate > lhs.m_dRate)
+        {
+            return lhs.m_dRate > rhs.m_dRate;
+        }
+        return lhs.m_uFailures > rhs.m_uFailures;
+    });
+    std::cout << std::right << std::setw(12) << "failures" << std::setw(12) << "rate/s" << "  "
+              << std::left << std::setw(9) << "level" << "site" << std::endl;
+    for (std::size_t i = 0; i < std::min(sites.size(), s_uTopCount); ++i)
+    {
+        const auto& site = sites[i];
+        std::cout << std::right << std::setw(12) << site.m_uFailures
+                  << std::setw(12) << std::fixed << std::setprecision(1) << site.m_dRate << "  "
+                  << std::left << std::setw(9) << LevelName(site.m_uLevel)
+                  << site.m_strFile << ":" << site.m_iLine << " " << site.m_strFunction
+                  << ": " << site.m_strExpression << std::endl;
+    }
+    std::cout.flush();
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <pid> [interval ms] [iterations]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string name = std::string { "/dbgh." } + argv[1];
+    const auto interval = std::chrono::milliseconds { argc > 2 ? std::atoi(argv[2]) : 1000 };
+    const int iterations = argc > 3 ? std::atoi(argv[3]) : 0;
+
+    CSegment segment;
+    if (! segment.Remap(name))
+    {
+        std::cerr << "Cannot map " << name << ", the process does not publish the statistics." << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (! IsSupported(*segment.Get()))
+    {
+        std::cerr << "Unsupported layout of " << name << "." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::map<std::uint64_t, std::uint64_t> previousFailures;
+    auto previousTime = std::chrono::steady_clock::now();
+    for (int iteration = 0; 0 == iterations || iteration < iterations; ++iteration)
+    {
+        if (0 != iteration)
+        {
+            std::this_thread::sleep_for(interval);
+        }
+        if (0 != iteration && segment.Remap(name))
+        {
+            // The writer is restarted, the rates of the old sites are not continued.
+            if (! IsSupported(*segment.Get()))
+            {
+                std::cerr << "Unsupported layout of " << name << "." << std::endl;
+                return EXIT_FAILURE;
+            }
+            previousFailures.clear();
+        }
+        const auto& stats = *segment.Get();
+        const auto now = std::chrono::steady_clock::now();
+        const auto seconds = std::chrono::duration<double>(now - previousTime).count();
+        previousTime = now;
+
+        std::vector<SSite> sites;
+        for (const auto& shared : stats.m_arrSites)
+        {
+            SSite site { };
+            if (! ReadSite(shared, site))
+            {
+                continue;
+            }
+            auto& previous = previousFailures[site.m_uKey];
+            site.m_dRate = (0 != iteration && seconds > 0)
+                           ? static_cast<double>(site.m_uFailures - previous) / seconds : 0.0;
+            previous = site.m_uFailures;
+            sites.push_back(std::move(site));
+        }
+        Print(stats, sites, 0 == iterations);
+    }
+    return EXIT_SUCCESS;
+}